@@ -0,0 +1,387 @@
+#include <genesis.h>
+#include "BenchmarkSuite.h"
+#include "DMAScheduler.h"
+#include "graphics.h"
+#include "JoypadHandler.h"
+#include "mapdata.h"
+#include "MathUtil.h"
+#include "Profiler.h"
+#include "ScrollingMap.h"
+#include "TileDecoder.h"
+
+#if (BENCHMARK != 0)
+
+#define CAMERA_LIMIT_X (TILE_TO_PIXEL(TILEMAP_FG_TILE_WIDTH) - SCREEN_PIXEL_WIDTH)
+#define CAMERA_LIMIT_Y (TILE_TO_PIXEL(TILEMAP_FG_TILE_HEIGHT) - SCREEN_PIXEL_HEIGHT)
+
+// How the camera moves in a scenario.
+#define MOTION_PAN_X 0      // Back and forth across the map, speed pixels per frame
+#define MOTION_PAN_Y 1
+#define MOTION_DIAGONAL 2
+#define MOTION_OSCILLATE 3  // Back and forth by speed pixels every frame, across a tile boundary on both axes
+#define MOTION_TELEPORT 4   // Somewhere else on the map every speed frames
+
+// Ways of loading the tilesets to time.
+#define TILE_LOAD_RAW 0         // VDP_loadTileData from graphics.c, as ScrollingMap_init does without compression
+#define TILE_LOAD_COMPRESSED 1  // TileDecoder_loadTiles from mapdata.c
+#define TILE_LOAD_DECODE 2      // Just the decoding, into staging RAM with no DMA
+
+#define TILESET_BYTES ((TILESET_BG_TILE_COUNT + TILESET_FG_TILE_COUNT) * 32)
+
+// The tile boundary MOTION_OSCILLATE goes back and forth across.
+#define OSCILLATE_CENTRE_X 160
+#define OSCILLATE_CENTRE_Y 152
+
+typedef struct
+{
+    const char* name;
+    u16 motion;
+    u16 speed;
+} BenchmarkScenario;
+
+typedef struct
+{
+    u32 totalLines;
+    u16 maxLines;
+    u32 totalDmaBytes;
+    u16 maxDmaBytes;
+    u16 lagFrames;
+} ScenarioResult;
+
+const BenchmarkScenario scenarios[] =
+{
+    { "PAN X 1", MOTION_PAN_X, 1 },
+    { "PAN X 2", MOTION_PAN_X, 2 },
+    { "PAN X 3", MOTION_PAN_X, 3 },
+    { "PAN X 4", MOTION_PAN_X, 4 },
+    { "PAN X 6", MOTION_PAN_X, 6 },
+    { "PAN X 8", MOTION_PAN_X, 8 },
+    { "PAN X 12", MOTION_PAN_X, 12 },
+    { "PAN X 16", MOTION_PAN_X, 16 },
+    { "PAN Y 1", MOTION_PAN_Y, 1 },
+    { "PAN Y 2", MOTION_PAN_Y, 2 },
+    { "PAN Y 4", MOTION_PAN_Y, 4 },
+    { "PAN Y 8", MOTION_PAN_Y, 8 },
+    { "PAN Y 16", MOTION_PAN_Y, 16 },
+    { "DIAG 1", MOTION_DIAGONAL, 1 },
+    { "DIAG 4", MOTION_DIAGONAL, 4 },
+    { "DIAG 16", MOTION_DIAGONAL, 16 },
+    { "OSC 2", MOTION_OSCILLATE, 2 },
+    { "OSC 16", MOTION_OSCILLATE, 16 },
+    { "TELEPORT", MOTION_TELEPORT, 30 }
+};
+
+#define SCENARIO_COUNT (sizeof(scenarios) / sizeof(BenchmarkScenario))
+
+ScenarioResult results[SCENARIO_COUNT];
+
+u16 scenarioIndex;
+
+// Frames of the current scenario so far.  The first one only puts the camera in place, so it isn't measured.
+u16 scenarioFrame;
+bool measuringFrame;
+
+s16 directionX;
+s16 directionY;
+
+// vtimer when the frame started, to tell whether it finished in time.
+u32 frameStartVTimer;
+
+u32 randomState;
+
+void startScenario(const BenchmarkScenario* scenario);
+void moveCamera(const BenchmarkScenario* scenario);
+u32 bounce(u32 position, u16 speed, u32 limit, s16* direction);
+void drawResult(u16 row, const char* name, const ScenarioResult* result, u16 frames);
+void drawTileLoadResults(u16 row);
+u16 timeTileLoad(u16 method);
+void decodeTileset(const u16* data, const u16* blocks, u16 tileCount, u16 blockTiles, u16* buffer);
+u32 nextRandom();
+
+void BenchmarkSuite_init()
+{
+    memset(results, 0, sizeof(results));
+    scenarioIndex = 0;
+    scenarioFrame = 0;
+    randomState = 1;
+
+    // The window's top row shows which scenario is running.
+    VDP_setTextPalette(PAL3);
+    VDP_setWindowHPos(FALSE, 0);
+    VDP_setWindowVPos(FALSE, 1);
+}
+
+bool BenchmarkSuite_update()
+{
+    frameStartVTimer = vtimer;
+
+    if (scenarioFrame > BENCHMARK_FRAMES_PER_SCENARIO)
+    {
+        scenarioIndex++;
+        scenarioFrame = 0;
+    }
+
+    if (scenarioIndex == SCENARIO_COUNT)
+    {
+        return FALSE;
+    }
+
+    const BenchmarkScenario* scenario = &scenarios[scenarioIndex];
+    measuringFrame = (scenarioFrame != 0);
+    if (measuringFrame)
+    {
+        moveCamera(scenario);
+    }
+    else
+    {
+        startScenario(scenario);
+    }
+
+    scenarioFrame++;
+    return TRUE;
+}
+
+void BenchmarkSuite_record(u16 scanlines, u16 dmaBytes)
+{
+    if (!measuringFrame)
+    {
+        return;
+    }
+
+    ScenarioResult* result = &results[scenarioIndex];
+    result->totalLines += scanlines;
+    if (scanlines > result->maxLines)
+    {
+        result->maxLines = scanlines;
+    }
+
+    result->totalDmaBytes += dmaBytes;
+    if (dmaBytes > result->maxDmaBytes)
+    {
+        result->maxDmaBytes = dmaBytes;
+    }
+
+    // vtimer goes up at the start of vblank, so if it already has, this frame's work didn't fit in the frame.
+    result->lagFrames += vtimer - frameStartVTimer;
+}
+
+void BenchmarkSuite_showResults()
+{
+    char text[41];
+
+    // The window covers the whole screen, so the planes don't matter any more.
+    VDP_setWindowVPos(FALSE, SCREEN_TILE_HEIGHT);
+    VDP_clearPlane(WINDOW, TRUE);
+
+    VDP_drawTextBG(WINDOW, IS_PALSYSTEM ? "BENCHMARK (PAL)" : "BENCHMARK (NTSC)", 0, 0);
+    sprintf(text, "%-10s %-7s %-11s", "", "LINES", "DMA BYTES");
+    VDP_drawTextBG(WINDOW, text, 0, 2);
+    sprintf(text, "%-10s %3s %3s %5s %5s %4s", "SCENARIO", "AVG", "MAX", "AVG", "MAX", "LAG");
+    VDP_drawTextBG(WINDOW, text, 0, 3);
+
+    // The last row is every scenario together.
+    ScenarioResult total;
+    memset(&total, 0, sizeof(total));
+
+    u16 i;
+    for (i = 0; i < SCENARIO_COUNT; i++)
+    {
+        const ScenarioResult* result = &results[i];
+        drawResult(4 + i, scenarios[i].name, result, BENCHMARK_FRAMES_PER_SCENARIO);
+
+        total.totalLines += result->totalLines;
+        total.totalDmaBytes += result->totalDmaBytes;
+        total.lagFrames += result->lagFrames;
+        if (result->maxLines > total.maxLines)
+        {
+            total.maxLines = result->maxLines;
+        }
+
+        if (result->maxDmaBytes > total.maxDmaBytes)
+        {
+            total.maxDmaBytes = result->maxDmaBytes;
+        }
+    }
+
+    drawResult(5 + SCENARIO_COUNT, "ALL", &total, BENCHMARK_FRAMES_PER_SCENARIO * SCENARIO_COUNT);
+    drawTileLoadResults(7 + SCENARIO_COUNT);
+}
+
+void startScenario(const BenchmarkScenario* scenario)
+{
+    directionX = 1;
+    directionY = 1;
+
+    switch (scenario->motion)
+    {
+        case MOTION_PAN_X:
+            fgCameraPixelX = 0;
+            fgCameraPixelY = CAMERA_LIMIT_Y >> 1;
+            break;
+        case MOTION_PAN_Y:
+            fgCameraPixelX = CAMERA_LIMIT_X >> 1;
+            fgCameraPixelY = 0;
+            break;
+        case MOTION_DIAGONAL:
+            fgCameraPixelX = 0;
+            fgCameraPixelY = 0;
+            break;
+        case MOTION_OSCILLATE:
+            fgCameraPixelX = OSCILLATE_CENTRE_X - (scenario->speed >> 1);
+            fgCameraPixelY = OSCILLATE_CENTRE_Y - (scenario->speed >> 1);
+            break;
+        case MOTION_TELEPORT:
+            fgCameraPixelX = nextRandom() % (CAMERA_LIMIT_X + 1);
+            fgCameraPixelY = nextRandom() % (CAMERA_LIMIT_Y + 1);
+            break;
+    }
+
+    VDP_clearTextLineBG(WINDOW, 0);
+    VDP_drawTextBG(WINDOW, scenario->name, 0, 0);
+}
+
+void moveCamera(const BenchmarkScenario* scenario)
+{
+    switch (scenario->motion)
+    {
+        case MOTION_PAN_X:
+            fgCameraPixelX = bounce(fgCameraPixelX, scenario->speed, CAMERA_LIMIT_X, &directionX);
+            break;
+        case MOTION_PAN_Y:
+            fgCameraPixelY = bounce(fgCameraPixelY, scenario->speed, CAMERA_LIMIT_Y, &directionY);
+            break;
+        case MOTION_DIAGONAL:
+            fgCameraPixelX = bounce(fgCameraPixelX, scenario->speed, CAMERA_LIMIT_X, &directionX);
+            fgCameraPixelY = bounce(fgCameraPixelY, scenario->speed, CAMERA_LIMIT_Y, &directionY);
+            break;
+        case MOTION_OSCILLATE:
+            fgCameraPixelX = bounce(fgCameraPixelX, scenario->speed, CAMERA_LIMIT_X, &directionX);
+            fgCameraPixelY = bounce(fgCameraPixelY, scenario->speed, CAMERA_LIMIT_Y, &directionY);
+            directionX = -directionX;
+            directionY = -directionY;
+            break;
+        case MOTION_TELEPORT:
+            if (scenarioFrame % scenario->speed == 0)
+            {
+                fgCameraPixelX = nextRandom() % (CAMERA_LIMIT_X + 1);
+                fgCameraPixelY = nextRandom() % (CAMERA_LIMIT_Y + 1);
+            }
+            break;
+    }
+}
+
+// Move speed pixels in direction, turning around at 0 and limit.
+u32 bounce(u32 position, u16 speed, u32 limit, s16* direction)
+{
+    if (*direction > 0)
+    {
+        if (position + speed >= limit)
+        {
+            *direction = -1;
+            return limit;
+        }
+
+        return position + speed;
+    }
+
+    if (position <= speed)
+    {
+        *direction = 1;
+        return 0;
+    }
+
+    return position - speed;
+}
+
+void drawResult(u16 row, const char* name, const ScenarioResult* result, u16 frames)
+{
+    char text[41];
+    sprintf(text, "%-10s %3u %3u %5u %5u %4u", name, (u16) (result->totalLines / frames), result->maxLines,
+        (u16) (result->totalDmaBytes / frames), result->maxDmaBytes, result->lagFrames);
+    VDP_drawTextBG(WINDOW, text, 0, row);
+}
+
+// Time each way of loading the tilesets.  They load the tiles already in VRAM over themselves, so nothing on screen
+// changes.
+void drawTileLoadResults(u16 row)
+{
+    u16 rawLines = timeTileLoad(TILE_LOAD_RAW);
+    u16 compressedLines = timeTileLoad(TILE_LOAD_COMPRESSED);
+    u16 decodeLines = timeTileLoad(TILE_LOAD_DECODE);
+
+    // Decoder throughput, in uncompressed bytes per frame.
+    u32 bytesPerFrame = (u32) TILESET_BYTES * (IS_PALSYSTEM ? 313 : 262) / ((decodeLines != 0) ? decodeLines : 1);
+    if (bytesPerFrame > 0xFFFF)
+    {
+        bytesPerFrame = 0xFFFF;
+    }
+
+    char text[41];
+    sprintf(text, "TILES %5u LINES RAW, %5u LZ", rawLines, compressedLines);
+    VDP_drawTextBG(WINDOW, text, 0, row);
+    sprintf(text, "DECODE %5u LINES, %5u BYTES/FRAME", decodeLines, (u16) bytesPerFrame);
+    VDP_drawTextBG(WINDOW, text, 0, row + 1);
+}
+
+// Returns the scanlines one way of loading both tilesets took.
+u16 timeTileLoad(u16 method)
+{
+    u16* buffer = NULL;
+    if (method == TILE_LOAD_DECODE)
+    {
+        // Nothing is waiting to be sent between frames, so the staging RAM is free.
+        buffer = DMAScheduler_allocStaging(TILEDECODER_MAX_BLOCK_TILES * 32);
+        if (buffer == NULL)
+        {
+            return 0;
+        }
+    }
+
+    Profiler_beginZone(PROFILER_ZONE_TILE_LOAD);
+    switch (method)
+    {
+        case TILE_LOAD_RAW:
+            VDP_loadTileData((const u32*) TILESET_BG, MAP_TILE_START_IDX, TILESET_BG_TILE_COUNT, 0);
+            VDP_loadTileData((const u32*) TILESET_FG, MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT, TILESET_FG_TILE_COUNT, 0);
+            break;
+        case TILE_LOAD_COMPRESSED:
+            TileDecoder_loadTiles(TILESET_BG_LZ, TILESET_BG_LZ_BLOCKS, TILESET_BG_LZ_TILE_COUNT, TILESET_BG_LZ_BLOCK_TILES,
+                MAP_TILE_START_IDX);
+            TileDecoder_loadTiles(TILESET_FG_LZ, TILESET_FG_LZ_BLOCKS, TILESET_FG_LZ_TILE_COUNT, TILESET_FG_LZ_BLOCK_TILES,
+                MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT);
+            break;
+        case TILE_LOAD_DECODE:
+            decodeTileset(TILESET_BG_LZ, TILESET_BG_LZ_BLOCKS, TILESET_BG_LZ_TILE_COUNT, TILESET_BG_LZ_BLOCK_TILES, buffer);
+            decodeTileset(TILESET_FG_LZ, TILESET_FG_LZ_BLOCKS, TILESET_FG_LZ_TILE_COUNT, TILESET_FG_LZ_BLOCK_TILES, buffer);
+            break;
+    }
+    Profiler_endZone(PROFILER_ZONE_TILE_LOAD);
+
+    if (buffer != NULL)
+    {
+        DMAScheduler_freeStaging(buffer);
+    }
+
+    return Profiler_getZone(PROFILER_ZONE_TILE_LOAD)->lastLines;
+}
+
+// Decode every block of a tileset into buffer, each over the last.
+void decodeTileset(const u16* data, const u16* blocks, u16 tileCount, u16 blockTiles, u16* buffer)
+{
+    u16 tile;
+    for (tile = 0; tile < tileCount; tile += blockTiles)
+    {
+        u16 count = (tileCount - tile < blockTiles) ? tileCount - tile : blockTiles;
+        TileDecoder_decodeBlock(data + *blocks, buffer, count << 4);
+        blocks++;
+    }
+}
+
+// A small LCG, so the teleports are the same on every run.
+u32 nextRandom()
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 16) & 0x7FFF;
+}
+
+#endif
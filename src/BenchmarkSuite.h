@@ -0,0 +1,31 @@
+#ifndef BENCHMARKSUITE_H
+#define BENCHMARKSUITE_H
+
+#include <genesis.h>
+
+// When nonzero, main.c ignores the joypad and the HUD and drives the camera through a fixed set of scenarios (pans at
+// a range of speeds, diagonals, oscillating across a tile boundary and teleports), then shows the worst and average
+// scanlines and DMA bytes of each, and any lag frames.  Every scenario is the same on every run, so the table can be
+// compared between builds.  Afterwards it times loading the tilesets uncompressed and compressed, and decoding the
+// compressed ones alone.  Needs PROFILER_ENABLED.  Can also be set from the compiler's command line.
+#ifndef BENCHMARK
+#define BENCHMARK 0
+#endif
+
+// How long each scenario runs, not counting a frame to get the camera in place first.
+#define BENCHMARK_FRAMES_PER_SCENARIO 240
+
+#if (BENCHMARK != 0)
+void BenchmarkSuite_init();
+
+// Move the camera for this frame.  Call in place of Joypad_update.  Returns FALSE once every scenario has run.
+bool BenchmarkSuite_update();
+
+// Add this frame to the current scenario's numbers.  Call after DMAScheduler_flush and before SYS_doVBlankProcess.
+void BenchmarkSuite_record(u16 scanlines, u16 dmaBytes);
+
+// Clear the screen, time the tileset loads and show the results.
+void BenchmarkSuite_showResults();
+#endif
+
+#endif // BENCHMARKSUITE_H
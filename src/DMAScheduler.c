@@ -0,0 +1,237 @@
+#include <genesis.h>
+#include "DMAScheduler.h"
+
+typedef struct
+{
+    u16 priority;
+    u8 location;
+    void* from;
+    u16 to;
+    u16 len;
+    u16 step;
+} DMATransfer;
+
+// Bytes that fit in one vblank.
+u16 dmaBudget;
+
+// Bytes claimed so far this frame.
+u16 dmaBytesReserved;
+
+u16 dmaLastFrameBytes;
+
+// Bytes claimed at each priority, this frame and last.
+u16 dmaPriorityBytes[DMA_PRIORITY_COUNT];
+u16 dmaLastFramePriorityBytes[DMA_PRIORITY_COUNT];
+
+// Transfers waiting to be sent, oldest first.
+DMATransfer dmaQueue[DMA_SCHEDULER_QUEUE_SIZE];
+u16 dmaQueueCount;
+
+// Bytes waiting in dmaQueue for each priority.
+u16 dmaQueuedBytes[DMA_PRIORITY_COUNT];
+
+// Bump allocated each frame.  Kept as words so every allocation is word aligned for the DMA.
+u16 dmaStaging[DMA_STAGING_SIZE >> 1];
+u16 dmaStagingUsed;  // In words
+
+bool fitsInBudget(u16 priority, u16 byteCount, u16 bytesAhead);
+
+void DMAScheduler_init()
+{
+    dmaBudget = IS_PALSYSTEM ? DMA_BUDGET_PAL : DMA_BUDGET_NTSC;
+    dmaBytesReserved = 0;
+    dmaLastFrameBytes = 0;
+    dmaQueueCount = 0;
+    dmaStagingUsed = 0;
+
+    u16 i;
+    for (i = 0; i < DMA_PRIORITY_COUNT; i++)
+    {
+        dmaQueuedBytes[i] = 0;
+        dmaPriorityBytes[i] = 0;
+        dmaLastFramePriorityBytes[i] = 0;
+    }
+}
+
+void DMAScheduler_setBudget(u16 byteCount)
+{
+    dmaBudget = byteCount;
+}
+
+bool DMAScheduler_reserve(u16 priority, u16 byteCount)
+{
+    // Anything more important that's already waiting gets to go first.
+    u16 bytesAhead = 0;
+    u16 i;
+    for (i = 0; i < priority; i++)
+    {
+        bytesAhead += dmaQueuedBytes[i];
+    }
+
+    if (!fitsInBudget(priority, byteCount, bytesAhead))
+    {
+        return FALSE;
+    }
+
+    dmaBytesReserved += byteCount;
+    dmaPriorityBytes[priority] += byteCount;
+    return TRUE;
+}
+
+bool DMAScheduler_queue(u16 priority, u8 location, void* from, u16 to, u16 len, u16 step)
+{
+    if (dmaQueueCount == DMA_SCHEDULER_QUEUE_SIZE)
+    {
+        return FALSE;
+    }
+
+    DMATransfer* transfer = &dmaQueue[dmaQueueCount];
+    transfer->priority = priority;
+    transfer->location = location;
+    transfer->from = from;
+    transfer->to = to;
+    transfer->len = len;
+    transfer->step = step;
+
+    dmaQueueCount++;
+    dmaQueuedBytes[priority] += len << 1;
+    return TRUE;
+}
+
+void DMAScheduler_flush()
+{
+    u16 priority;
+    u16 i;
+
+    // Send transfers in priority order, oldest first within each priority, until one doesn't fit.  Later ones wait
+    // behind it so nothing is sent out of order.
+    bool full = FALSE;
+    for (priority = 0; priority < DMA_PRIORITY_COUNT && !full; priority++)
+    {
+        for (i = 0; i < dmaQueueCount; i++)
+        {
+            DMATransfer* transfer = &dmaQueue[i];
+            if (transfer->priority != priority)
+            {
+                continue;
+            }
+
+            u16 byteCount = transfer->len << 1;
+            if (!fitsInBudget(priority, byteCount, 0))
+            {
+                full = TRUE;
+                break;
+            }
+
+            DMA_queueDma(transfer->location, transfer->from, transfer->to, transfer->len, transfer->step);
+            dmaBytesReserved += byteCount;
+            dmaPriorityBytes[priority] += byteCount;
+            dmaQueuedBytes[priority] -= byteCount;
+
+            // Mark it as sent.
+            transfer->len = 0;
+        }
+    }
+
+    // Drop the transfers that were sent.
+    u16 remaining = 0;
+    for (i = 0; i < dmaQueueCount; i++)
+    {
+        if (dmaQueue[i].len != 0)
+        {
+            dmaQueue[remaining] = dmaQueue[i];
+            remaining++;
+        }
+    }
+    dmaQueueCount = remaining;
+
+    dmaLastFrameBytes = dmaBytesReserved;
+    dmaBytesReserved = 0;
+
+    for (priority = 0; priority < DMA_PRIORITY_COUNT; priority++)
+    {
+        dmaLastFramePriorityBytes[priority] = dmaPriorityBytes[priority];
+        dmaPriorityBytes[priority] = 0;
+    }
+}
+
+void* DMAScheduler_allocStaging(u16 byteCount)
+{
+    u16 wordCount = (byteCount + 1) >> 1;
+    if (wordCount > (DMA_STAGING_SIZE >> 1) - dmaStagingUsed)
+    {
+        return NULL;
+    }
+
+    u16* buffer = dmaStaging + dmaStagingUsed;
+    dmaStagingUsed += wordCount;
+    return buffer;
+}
+
+void DMAScheduler_freeStaging(void* buffer)
+{
+    dmaStagingUsed = (u16*) buffer - dmaStaging;
+}
+
+void DMAScheduler_releaseStaging()
+{
+    u16* stagingEnd = dmaStaging + dmaStagingUsed;
+    u16* nextFrom = dmaStaging;
+    dmaStagingUsed = 0;
+
+    // Slide the staged data that's still queued down to the start of the area, lowest address first so nothing is
+    // overwritten before it's moved.  Anything below nextFrom has already been moved.
+    while (TRUE)
+    {
+        DMATransfer* lowest = NULL;
+        u16 i;
+        for (i = 0; i < dmaQueueCount; i++)
+        {
+            u16* from = (u16*) dmaQueue[i].from;
+            if (from >= nextFrom && from < stagingEnd && (lowest == NULL || from < (u16*) lowest->from))
+            {
+                lowest = &dmaQueue[i];
+            }
+        }
+
+        if (lowest == NULL)
+        {
+            break;
+        }
+
+        u16* src = (u16*) lowest->from;
+        u16* dst = dmaStaging + dmaStagingUsed;
+        nextFrom = src + lowest->len;
+        lowest->from = dst;
+        dmaStagingUsed += lowest->len;
+
+        for (i = lowest->len; i != 0; i--)
+        {
+            *dst = *src;
+            dst++;
+            src++;
+        }
+    }
+}
+
+u16 DMAScheduler_getLastFrameBytes()
+{
+    return dmaLastFrameBytes;
+}
+
+u16 DMAScheduler_getLastFrameBytesAt(u16 priority)
+{
+    return dmaLastFramePriorityBytes[priority];
+}
+
+bool fitsInBudget(u16 priority, u16 byteCount, u16 bytesAhead)
+{
+    // The scroll table and foreground always go out, and so does anything that's first in line this frame; otherwise a
+    // transfer bigger than the whole budget would never be sent.
+    if (priority <= DMA_PRIORITY_FG || dmaBytesReserved + bytesAhead == 0)
+    {
+        return TRUE;
+    }
+
+    return dmaBytesReserved + bytesAhead + byteCount <= dmaBudget;
+}
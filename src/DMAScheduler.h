@@ -0,0 +1,66 @@
+#ifndef DMASCHEDULER_H
+#define DMASCHEDULER_H
+
+#include <genesis.h>
+
+// How many bytes can be DMA'd to VRAM during one vblank in H40 mode, leaving some room for SGDK's own transfers (the
+// sprite list, etc).  NTSC has 38 blank lines and PAL has 89, at roughly 200 bytes per line.
+#define DMA_BUDGET_NTSC 7000
+#define DMA_BUDGET_PAL 16500
+
+// Transfers are sent in this order.  Anything that doesn't fit in the frame's budget waits for the next frame, except
+// DMA_PRIORITY_SCROLL and DMA_PRIORITY_FG which always go out since the scroll table has to match the camera and the
+// foreground can't show a stale column or row.
+#define DMA_PRIORITY_SCROLL 0
+#define DMA_PRIORITY_FG 1
+#define DMA_PRIORITY_REDRAW 2  // Columns of a screen redraw spread over several frames
+#define DMA_PRIORITY_BG 3
+#define DMA_PRIORITY_TILES 4
+#define DMA_PRIORITY_PREFETCH 5
+#define DMA_PRIORITY_COUNT 6
+
+// Maximum number of transfers waiting to be sent.
+#define DMA_SCHEDULER_QUEUE_SIZE 32
+
+// Bytes of RAM for building data to be DMA'd (seams gathered from the map, decompressed tiles, palettes, ...).  Enough
+// for both planes to draw SCROLLINGMAP_MAX_SEAMS_PER_FRAME full-width rows and columns in the same frame.
+#define DMA_STAGING_SIZE 2048
+
+void DMAScheduler_init();
+
+// Change how many bytes each frame may send from the console's default, DMA_BUDGET_NTSC or DMA_BUDGET_PAL (to leave room
+// for a big sprite upload, say).
+void DMAScheduler_setBudget(u16 byteCount);
+
+// Claim part of this frame's budget for a transfer that will be queued with DMA_queueDma right away (seams use this,
+// since they're cheaper to redraw later than to keep around).  Returns FALSE if the transfer has to wait for a later
+// frame.
+bool DMAScheduler_reserve(u16 priority, u16 byteCount);
+
+// Queue a transfer to be sent in priority order when the frame is flushed.  The source data has to stay valid until
+// it's been sent, which may be a few frames if the budget is tight.  Returns FALSE if the queue is full.
+bool DMAScheduler_queue(u16 priority, u8 location, void* from, u16 to, u16 len, u16 step);
+
+// Hand as many queued transfers to SGDK's DMA queue as fit in the rest of this frame's budget, then start a new frame.
+// Call just before SYS_doVBlankProcess.
+void DMAScheduler_flush();
+
+// Reserve byteCount bytes of staging RAM to DMA from.  It stays valid until the vblank that sends it is over, or for as
+// long as it's waiting in the scheduler's queue.  Returns NULL if there isn't enough left this frame.
+void* DMAScheduler_allocStaging(u16 byteCount);
+
+// Give back the last block DMAScheduler_allocStaging handed out, if it wasn't needed after all or whatever was built in
+// it has gone (by DMA_doDma, say).
+void DMAScheduler_freeStaging(void* buffer);
+
+// Free the staging RAM used by transfers that have been sent.  Whatever is still waiting in the queue is moved to the
+// start of the staging area.  Call just after SYS_doVBlankProcess.
+void DMAScheduler_releaseStaging();
+
+// Bytes sent to SGDK's DMA queue by the last flush.
+u16 DMAScheduler_getLastFrameBytes();
+
+// The part of those bytes sent at one priority.
+u16 DMAScheduler_getLastFrameBytesAt(u16 priority);
+
+#endif // DMASCHEDULER_H
@@ -0,0 +1,30 @@
+/* Written by hand, in the same form as tools/host/recording2c generates */
+
+#include "JoypadHandler.h"
+
+// 642 frames: frame count and joypad state of each run.
+const JoypadRun demoRecording[] =
+{
+    { 60, 0x0000 },
+    { 80, 0x0008 },
+    { 76, 0x0002 },
+    { 80, 0x0004 },
+    { 76, 0x0001 },
+    { 76, 0x000A },
+    { 14, 0x0044 },
+    { 13, 0x0041 },
+    { 14, 0x0048 },
+    { 13, 0x0042 },
+    { 30, 0x0000 },
+    { 40, 0x0005 },
+    { 2, 0x0008 },
+    { 2, 0x0004 },
+    { 2, 0x0008 },
+    { 2, 0x0004 },
+    { 1, 0x0080 },
+    { 30, 0x0000 },
+    { 1, 0x0080 },
+    { 30, 0x0000 }
+};
+
+const u16 demoRecordingRunCount = 20;
@@ -0,0 +1,12 @@
+#ifndef DEMORECORDING_H
+#define DEMORECORDING_H
+
+#include "JoypadHandler.h"
+
+// A tour of the map for Joypad_replay: pans in each direction to the edges, diagonals, dashes, a little back and forth
+// and the HUD toggled off and on.  Replace DemoRecording.c with the output of tools/host/recording2c to replay
+// something recorded with JOYPAD_MODE_RECORD instead.
+extern const JoypadRun demoRecording[];
+extern const u16 demoRecordingRunCount;
+
+#endif // DEMORECORDING_H
@@ -0,0 +1,186 @@
+#include <genesis.h>
+#include "DMAScheduler.h"
+#include "Hud.h"
+
+#if (HUD_ENABLED != 0)
+
+// The window plane is always 64 tiles wide in H40.
+#define WINDOW_TILE_WIDTH 64
+
+#define HUD_TILE_WIDTH 40
+
+// SGDK's font starts at ' '.
+#define HUD_TILE(character) TILE_ATTR_FULL(PAL3, 1, 0, 0, TILE_FONT_INDEX + (character) - ' ')
+
+// One number on the HUD.
+typedef struct
+{
+    u16 row;
+    u16 column;
+    u16 digitCount;
+    u32 maxValue;
+} HudField;
+
+#define FIELD_SCANLINES 0
+#define FIELD_DMA_BYTES 1
+#define FIELD_SEAMS 2
+#define FIELD_LAG_FRAMES 3
+#define FIELD_CAMERA_X 4
+#define FIELD_CAMERA_Y 5
+#define FIELD_COUNT 6
+
+const char* const hudLabels[HUD_TILE_HEIGHT] =
+{
+    "LINES      DMA        SEAMS",
+    "LAG        X        Y"
+};
+
+const HudField hudFields[FIELD_COUNT] =
+{
+    { 0, 6, 3, 999 },      // FIELD_SCANLINES
+    { 0, 15, 5, 99999 },   // FIELD_DMA_BYTES
+    { 0, 28, 3, 999 },     // FIELD_SEAMS
+    { 1, 4, 5, 99999 },    // FIELD_LAG_FRAMES
+    { 1, 13, 5, 99999 },   // FIELD_CAMERA_X
+    { 1, 22, 5, 99999 }    // FIELD_CAMERA_Y
+};
+
+// The HUD's name-table words, as they are (or are about to be) in VRAM.  Queued DMAs read straight from here.
+u16 hudTiles[HUD_TILE_HEIGHT][HUD_TILE_WIDTH];
+
+// What each field currently shows, so unchanged fields can be skipped without working out their digits.
+u32 hudValues[FIELD_COUNT];
+
+bool hudVisible;
+
+void updateField(u16 field, u32 value);
+
+void Hud_init()
+{
+    u16 row;
+    for (row = 0; row < HUD_TILE_HEIGHT; row++)
+    {
+        const char* label = hudLabels[row];
+        u16 column;
+        for (column = 0; column < HUD_TILE_WIDTH; column++)
+        {
+            if (*label != '\0')
+            {
+                hudTiles[row][column] = HUD_TILE(*label);
+                label++;
+            }
+            else
+            {
+                hudTiles[row][column] = HUD_TILE(' ');
+            }
+        }
+    }
+
+    // Start every field at 0.
+    u16 field;
+    for (field = 0; field < FIELD_COUNT; field++)
+    {
+        const HudField* hudField = &hudFields[field];
+        u16 i;
+        for (i = 0; i < hudField->digitCount; i++)
+        {
+            hudTiles[hudField->row][hudField->column + i] = HUD_TILE('0');
+        }
+
+        hudValues[field] = 0;
+    }
+
+    for (row = 0; row < HUD_TILE_HEIGHT; row++)
+    {
+        DMA_doDma(DMA_VRAM, hudTiles[row], VDP_WINDOW + ((row * WINDOW_TILE_WIDTH) << 1), HUD_TILE_WIDTH, 2);
+    }
+
+    // The window covers whole rows from the top of the screen.
+    VDP_setWindowHPos(FALSE, 0);
+    Hud_setVisible(TRUE);
+}
+
+void Hud_setVisible(bool visible)
+{
+    hudVisible = visible;
+    VDP_setWindowVPos(FALSE, visible ? HUD_TILE_HEIGHT : 0);
+}
+
+bool Hud_isVisible()
+{
+    return hudVisible;
+}
+
+void Hud_update(u16 scanlines, u16 dmaBytes, u16 seams, u32 lagFrames, u32 cameraPixelX, u32 cameraPixelY)
+{
+    if (!hudVisible)
+    {
+        return;
+    }
+
+    updateField(FIELD_SCANLINES, scanlines);
+    updateField(FIELD_DMA_BYTES, dmaBytes);
+    updateField(FIELD_SEAMS, seams);
+    updateField(FIELD_LAG_FRAMES, lagFrames);
+    updateField(FIELD_CAMERA_X, cameraPixelX);
+    updateField(FIELD_CAMERA_Y, cameraPixelY);
+}
+
+// Queue one DMA covering whichever of a field's digits changed, and update them in hudTiles.
+void updateField(u16 field, u32 value)
+{
+    const HudField* hudField = &hudFields[field];
+    if (value > hudField->maxValue)
+    {
+        value = hudField->maxValue;
+    }
+
+    if (value == hudValues[field])
+    {
+        return;
+    }
+
+    // Digits from the right.  Every field fits in 16 bits once clamped, so this is a 16-bit divide per digit.
+    u16* tiles = &hudTiles[hudField->row][hudField->column];
+    u16 digits[5];
+    u16 remaining = value;
+    u16 firstChanged = hudField->digitCount;
+    u16 lastChanged = 0;
+    u16 i = hudField->digitCount;
+    while (i != 0)
+    {
+        i--;
+        digits[i] = HUD_TILE('0' + (remaining % 10));
+        remaining /= 10;
+
+        if (tiles[i] != digits[i])
+        {
+            if (firstChanged == hudField->digitCount)
+            {
+                lastChanged = i;
+            }
+
+            firstChanged = i;
+        }
+    }
+
+    if (firstChanged != hudField->digitCount)
+    {
+        // If the queue is full, try again next frame.
+        u16 addr = VDP_WINDOW + (((hudField->row * WINDOW_TILE_WIDTH) + hudField->column + firstChanged) << 1);
+        if (!DMAScheduler_queue(DMA_PRIORITY_TILES, DMA_VRAM, tiles + firstChanged, addr, lastChanged - firstChanged + 1, 2))
+        {
+            return;
+        }
+
+        // The DMA isn't sent until the flush, so there's still time to fill in what it sends.
+        for (i = firstChanged; i <= lastChanged; i++)
+        {
+            tiles[i] = digits[i];
+        }
+    }
+
+    hudValues[field] = value;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <genesis.h>
+
+// When nonzero, a two-line performance readout is shown in the window plane at the top of the screen:
+//
+//     LINES 123  DMA 12345  SEAMS 123
+//     LAG 12345  X 12345  Y 12345
+//
+// Only digits that changed are sent to VRAM, so it costs at most 52 bytes of DMA in a frame.
+#define HUD_ENABLED 1
+
+#define HUD_TILE_HEIGHT 2
+
+#if (HUD_ENABLED != 0)
+// Draw the labels and show the HUD.  Uses SGDK's font, which VDP_init loads, in PAL3 colour 15.
+void Hud_init();
+
+// The HUD covers the top of plane A while it's shown.
+void Hud_setVisible(bool visible);
+bool Hud_isVisible();
+
+// Queue DMAs for whichever digits changed since last time.  Call between ScrollingMap_update and
+// DMAScheduler_flush.  Values too big to show are shown as all nines.
+void Hud_update(u16 scanlines, u16 dmaBytes, u16 seams, u32 lagFrames, u32 cameraPixelX, u32 cameraPixelY);
+#endif
+
+#endif // HUD_H
@@ -1,38 +1,265 @@
 #include "JoypadHandler.h"
 
-// TOP_SPEED is in pixels/frame.  Maximum value is 8.
+// Speeds are in pixels/frame.  Any speed works; ScrollingMap_update catches up with however far the camera moved.
 #define TOP_SPEED 4
 
+// Speed while A is held, for testing springs and dashes.
+#define DASH_SPEED 24
+
 u16 joystate;
-u16 pressedStart = 0;
+u16 previousJoystate = 0;
+
+u16 joypadMode = JOYPAD_MODE_LIVE;
+
+// The recording, in RAM or (if recordRuns is NULL) SRAM.  currentRun is the last run, which grows while the joypad
+// state stays the same.
+JoypadRun* recordRuns;
+u16 recordMaxRuns;
+u16 recordRunCount;
+JoypadRun currentRun;
+
+// The replay, from RAM or ROM or (if replayRuns is NULL) SRAM.
+const JoypadRun* replayRuns;
+u16 replayRunCount;
+u16 replayRunIndex;
+u16 replayFramesLeft;
+u16 replayJoystate;
+bool replayFinished;
+
+u16 readJoystate();
+void recordJoystate(u16 state);
+u16 replayNextJoystate();
+void readSramRun(u16 index, JoypadRun* run);
+void writeSramRun(u16 index, const JoypadRun* run);
 
 void Joypad_update()
 {
-    joystate = JOY_readJoypad(JOY_1);
+    previousJoystate = joystate;
+    joystate = readJoystate();
+
+    u16 speed = (joystate & BUTTON_A) ? DASH_SPEED : TOP_SPEED;
 
     if (joystate & BUTTON_RIGHT)
     {
-        fgCameraPixelX += TOP_SPEED;
+        fgCameraPixelX += speed;
     }
     else if (joystate & BUTTON_LEFT)
     {
         // Since we're directly manipulating the camera, make sure it doesn't go negative.
-        if (fgCameraPixelX != 0)
+        if (fgCameraPixelX > speed)
         {
-            fgCameraPixelX -= TOP_SPEED;
+            fgCameraPixelX -= speed;
+        }
+        else
+        {
+            fgCameraPixelX = 0;
         }
     }
 
     if (joystate & BUTTON_UP)
     {
         // Since we're directly manipulating the camera, make sure it doesn't go negative.
-        if (fgCameraPixelY != 0)
+        if (fgCameraPixelY > speed)
+        {
+            fgCameraPixelY -= speed;
+        }
+        else
         {
-            fgCameraPixelY -= TOP_SPEED;
+            fgCameraPixelY = 0;
         }
     }
     else if (joystate & BUTTON_DOWN)
     {
-        fgCameraPixelY += TOP_SPEED;
+        fgCameraPixelY += speed;
+    }
+}
+
+bool Joypad_wasPressed(u16 button)
+{
+    return (joystate & button) && !(previousJoystate & button);
+}
+
+void Joypad_recordToRam(JoypadRun* runs, u16 maxRuns)
+{
+    joypadMode = JOYPAD_MODE_RECORD;
+    recordRuns = runs;
+    recordMaxRuns = maxRuns;
+    recordRunCount = 0;
+}
+
+void Joypad_recordToSram()
+{
+    u16 i;
+
+    joypadMode = JOYPAD_MODE_RECORD;
+    recordRuns = NULL;
+    recordMaxRuns = JOYPAD_SRAM_MAX_RUNS;
+    recordRunCount = 0;
+
+    SRAM_enable();
+    for (i = 0; i < 4; i++)
+    {
+        SRAM_writeByte(JOYPAD_SRAM_START + i, JOYPAD_SRAM_MAGIC[i]);
     }
+
+    SRAM_writeWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT, 0);
+    SRAM_writeWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT + 2, 0);
+    SRAM_disable();
+}
+
+void Joypad_replay(const JoypadRun* runs, u16 runCount)
+{
+    joypadMode = JOYPAD_MODE_REPLAY;
+    replayRuns = runs;
+    replayRunCount = runCount;
+    replayRunIndex = 0;
+    replayFramesLeft = 0;
+    replayFinished = (runCount == 0);
+}
+
+bool Joypad_replayFromSram()
+{
+    u16 i;
+
+    SRAM_enableRO();
+    for (i = 0; i < 4; i++)
+    {
+        if (SRAM_readByte(JOYPAD_SRAM_START + i) != JOYPAD_SRAM_MAGIC[i])
+        {
+            SRAM_disable();
+            return FALSE;
+        }
+    }
+
+    u16 runCount = SRAM_readWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT);
+    SRAM_disable();
+
+    if (runCount > JOYPAD_SRAM_MAX_RUNS)
+    {
+        return FALSE;
+    }
+
+    Joypad_replay(NULL, runCount);
+    return TRUE;
+}
+
+void Joypad_stop()
+{
+    joypadMode = JOYPAD_MODE_LIVE;
+}
+
+u16 Joypad_getMode()
+{
+    return joypadMode;
+}
+
+u16 Joypad_getRecordedRunCount()
+{
+    return recordRunCount;
+}
+
+bool Joypad_isReplayFinished()
+{
+    return replayFinished;
+}
+
+u16 readJoystate()
+{
+    if (joypadMode == JOYPAD_MODE_REPLAY)
+    {
+        return replayNextJoystate();
+    }
+
+    u16 state = JOY_readJoypad(JOY_1);
+    if (joypadMode == JOYPAD_MODE_RECORD)
+    {
+        recordJoystate(state);
+    }
+
+    return state;
+}
+
+// Add a frame to the recording, either by making the last run longer or starting a new one, and write the run out.
+void recordJoystate(u16 state)
+{
+    if (recordRunCount != 0 && state == currentRun.joystate && currentRun.frames != 0xFFFF)
+    {
+        currentRun.frames++;
+    }
+    else
+    {
+        if (recordRunCount == recordMaxRuns)
+        {
+            joypadMode = JOYPAD_MODE_LIVE;
+            return;
+        }
+
+        recordRunCount++;
+        currentRun.frames = 1;
+        currentRun.joystate = state;
+    }
+
+    if (recordRuns != NULL)
+    {
+        recordRuns[recordRunCount - 1] = currentRun;
+    }
+    else
+    {
+        writeSramRun(recordRunCount - 1, &currentRun);
+    }
+}
+
+u16 replayNextJoystate()
+{
+    while (replayFramesLeft == 0)
+    {
+        if (replayRunIndex == replayRunCount)
+        {
+            return 0;
+        }
+
+        JoypadRun run;
+        if (replayRuns != NULL)
+        {
+            run = replayRuns[replayRunIndex];
+        }
+        else
+        {
+            readSramRun(replayRunIndex, &run);
+        }
+
+        replayRunIndex++;
+        replayFramesLeft = run.frames;
+        replayJoystate = run.joystate;
+    }
+
+    replayFramesLeft--;
+    if (replayFramesLeft == 0 && replayRunIndex == replayRunCount)
+    {
+        replayFinished = TRUE;
+    }
+
+    return replayJoystate;
+}
+
+void readSramRun(u16 index, JoypadRun* run)
+{
+    u16 offset = JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_SIZE + (index * JOYPAD_SRAM_RUN_SIZE);
+
+    SRAM_enableRO();
+    run->frames = SRAM_readWord(offset);
+    run->joystate = SRAM_readWord(offset + 2);
+    SRAM_disable();
+}
+
+// Write a run, and the run count in the header so the recording includes it.
+void writeSramRun(u16 index, const JoypadRun* run)
+{
+    u16 offset = JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_SIZE + (index * JOYPAD_SRAM_RUN_SIZE);
+
+    SRAM_enable();
+    SRAM_writeWord(offset, run->frames);
+    SRAM_writeWord(offset + 2, run->joystate);
+    SRAM_writeWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT, index + 1);
+    SRAM_disable();
 }
@@ -3,8 +3,53 @@
 
 #include <genesis.h>
 
+// A run of frames with the same joypad state, for recording and replaying input.
+typedef struct
+{
+    u16 frames;
+    u16 joystate;
+} JoypadRun;
+
+// Where Joypad_update gets the joypad state.
+#define JOYPAD_MODE_LIVE 0
+#define JOYPAD_MODE_RECORD 1  // From the joypad, and also added to a recording
+#define JOYPAD_MODE_REPLAY 2  // From a recording
+
+// A recording in SRAM is kept in the first 4KB (so it can share the SRAM with PerfLog): "JOYR", the number of runs
+// (2 bytes), 2 bytes unused, then each run's frame count and joypad state, all big-endian.
+#define JOYPAD_SRAM_START 0
+#define JOYPAD_SRAM_SIZE 0x1000
+#define JOYPAD_SRAM_MAGIC "JOYR"
+#define JOYPAD_SRAM_HEADER_SIZE 8
+#define JOYPAD_SRAM_HEADER_RUN_COUNT 4
+#define JOYPAD_SRAM_RUN_SIZE 4
+#define JOYPAD_SRAM_MAX_RUNS ((JOYPAD_SRAM_SIZE - JOYPAD_SRAM_HEADER_SIZE) / JOYPAD_SRAM_RUN_SIZE)
+
 void Joypad_update();
 
+// Whether button went down in the last Joypad_update.
+bool Joypad_wasPressed(u16 button);
+
+// Record the joypad from the next Joypad_update on, into RAM or into SRAM.  The runs written so far always make a
+// complete recording, so it can be replayed (or the SRAM saved) at any point.  Recording stops when there's no room
+// for another run.
+void Joypad_recordToRam(JoypadRun* runs, u16 maxRuns);
+void Joypad_recordToSram();
+
+// Play a recording back from the next Joypad_update on, from RAM or ROM, or from SRAM.  When it runs out the joypad
+// reads as nothing pressed.  Joypad_replayFromSram returns FALSE if the SRAM doesn't hold a recording.
+void Joypad_replay(const JoypadRun* runs, u16 runCount);
+bool Joypad_replayFromSram();
+
+// Go back to reading the joypad.
+void Joypad_stop();
+
+u16 Joypad_getMode();
+
+// Runs recorded so far, and whether a replay has finished.
+u16 Joypad_getRecordedRunCount();
+bool Joypad_isReplayFinished();
+
 // TODO -- Normally these wouldn't be exposed here.  JoypadHandler would manipulate the player's
 // position and the camera's position would be calculated based on that.  However, for this demo
 // I let the JoypadHandler manipulate the camera coordinates directly.
@@ -0,0 +1,106 @@
+#include <genesis.h>
+#include "PerfLog.h"
+
+#if (PERFLOG_ENABLED != 0)
+
+// The record being built up, and how many frames it covers so far.
+u16 recordFrame;
+u16 recordScanlines;
+u16 recordDmaBytes;
+u16 recordSeams;
+u16 recordLagFrames;
+u16 recordFrameCount;
+
+u32 recordsWritten;
+
+// Where the next record goes.  Kept separately so the 68000 doesn't need a 32-bit divide every record.
+u16 nextSlot;
+
+void writeRecord();
+
+void PerfLog_init()
+{
+    SRAM_enable();
+
+    u16 i;
+    for (i = 0; i < 4; i++)
+    {
+        SRAM_writeByte(PERFLOG_SRAM_START + i, PERFLOG_MAGIC[i]);
+    }
+
+    SRAM_writeByte(PERFLOG_SRAM_START + PERFLOG_HEADER_VERSION, PERFLOG_VERSION);
+    SRAM_writeByte(PERFLOG_SRAM_START + PERFLOG_HEADER_RECORD_SIZE, PERFLOG_RECORD_SIZE);
+    SRAM_writeWord(PERFLOG_SRAM_START + PERFLOG_HEADER_FRAMES_PER_RECORD, PERFLOG_FRAMES_PER_RECORD);
+    SRAM_writeWord(PERFLOG_SRAM_START + PERFLOG_HEADER_CAPACITY, PERFLOG_CAPACITY);
+    SRAM_writeLong(PERFLOG_SRAM_START + PERFLOG_HEADER_RECORDS_WRITTEN, 0);
+    SRAM_writeWord(PERFLOG_SRAM_START + PERFLOG_HEADER_RECORDS_WRITTEN + 4, 0);
+
+    // Anything that writes to 0x200000 by mistake shouldn't be able to spoil the log.
+    SRAM_disable();
+
+    recordsWritten = 0;
+    nextSlot = 0;
+    recordFrameCount = 0;
+}
+
+void PerfLog_record(u16 scanlines, u16 dmaBytes, u16 seams, u16 lagFrames)
+{
+    if (recordFrameCount == 0)
+    {
+        recordFrame = vtimer;
+        recordScanlines = 0;
+        recordDmaBytes = 0;
+        recordSeams = 0;
+        recordLagFrames = 0;
+    }
+
+    if (scanlines > recordScanlines)
+    {
+        recordScanlines = scanlines;
+    }
+
+    if (dmaBytes > recordDmaBytes)
+    {
+        recordDmaBytes = dmaBytes;
+    }
+
+    if (seams > recordSeams)
+    {
+        recordSeams = seams;
+    }
+
+    recordLagFrames += lagFrames;
+    recordFrameCount++;
+
+    if (recordFrameCount == PERFLOG_FRAMES_PER_RECORD)
+    {
+        writeRecord();
+        recordFrameCount = 0;
+    }
+}
+
+// Write the record into the next slot of the ring, then bump the header's count so a save taken in between still
+// decodes.
+void writeRecord()
+{
+    u16 offset = PERFLOG_SRAM_START + PERFLOG_HEADER_SIZE + (nextSlot * PERFLOG_RECORD_SIZE);
+
+    SRAM_enable();
+    SRAM_writeWord(offset + PERFLOG_RECORD_FRAME, recordFrame);
+    SRAM_writeWord(offset + PERFLOG_RECORD_SCANLINES, recordScanlines);
+    SRAM_writeWord(offset + PERFLOG_RECORD_DMA_BYTES, recordDmaBytes);
+    SRAM_writeByte(offset + PERFLOG_RECORD_SEAMS, (recordSeams > 0xFF) ? 0xFF : recordSeams);
+    SRAM_writeByte(offset + PERFLOG_RECORD_LAG_FRAMES, (recordLagFrames > 0xFF) ? 0xFF : recordLagFrames);
+
+    nextSlot++;
+    if (nextSlot == PERFLOG_CAPACITY)
+    {
+        nextSlot = 0;
+    }
+
+    recordsWritten++;
+    SRAM_writeLong(PERFLOG_SRAM_START + PERFLOG_HEADER_RECORDS_WRITTEN, recordsWritten);
+    SRAM_disable();
+}
+
+#endif
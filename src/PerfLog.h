@@ -0,0 +1,56 @@
+#ifndef PERFLOG_H
+#define PERFLOG_H
+
+#include <genesis.h>
+
+// When nonzero, a record of every frame (or every PERFLOG_FRAMES_PER_RECORD frames) is written to a ring buffer in
+// the cartridge SRAM declared in rom_head.c, so a long session can be looked at afterwards by decoding the emulator's
+// save file with tools/host/perflog.  Unlike the HUD it doesn't touch the VDP, and writing a record takes a few
+// scanlines after the frame's own timing has been taken.
+#define PERFLOG_ENABLED 0
+
+// Each record keeps the worst scanlines, DMA bytes and seams of this many frames, and the total lag frames, so the log
+// covers a longer session.  At 1, the ring holds the last minute or so on NTSC.
+#define PERFLOG_FRAMES_PER_RECORD 1
+
+// The SRAM is 8 bits wide (on the odd addresses from 0x200001), so it holds 32KB.  The log has all of it after the
+// joypad recording (see JoypadHandler.h): a header followed by as many records as fit.  Everything is big-endian.
+//
+//     Header:  "PERF", version (1 byte), record size (1 byte), frames per record (2 bytes), record capacity (2 bytes),
+//              records written so far (4 bytes), 2 bytes unused.
+//     Record:  frame number (low 16 bits of vtimer at the start of the record), scanlines (2 bytes), DMA bytes
+//              (2 bytes), seams (1 byte), lag frames (1 byte).
+//
+// Once the ring is full, record (records written % capacity) is the oldest.
+#define PERFLOG_SRAM_START 0x1000
+#define PERFLOG_SRAM_SIZE 0x7000
+#define PERFLOG_MAGIC "PERF"
+#define PERFLOG_VERSION 1
+#define PERFLOG_HEADER_SIZE 16
+#define PERFLOG_RECORD_SIZE 8
+#define PERFLOG_CAPACITY ((PERFLOG_SRAM_SIZE - PERFLOG_HEADER_SIZE) / PERFLOG_RECORD_SIZE)
+
+// Offsets into the header (from PERFLOG_SRAM_START) and records.
+#define PERFLOG_HEADER_VERSION 4
+#define PERFLOG_HEADER_RECORD_SIZE 5
+#define PERFLOG_HEADER_FRAMES_PER_RECORD 6
+#define PERFLOG_HEADER_CAPACITY 8
+#define PERFLOG_HEADER_RECORDS_WRITTEN 10
+#define PERFLOG_RECORD_FRAME 0
+#define PERFLOG_RECORD_SCANLINES 2
+#define PERFLOG_RECORD_DMA_BYTES 4
+#define PERFLOG_RECORD_SEAMS 6
+#define PERFLOG_RECORD_LAG_FRAMES 7
+
+#if (PERFLOG_ENABLED != 0)
+// Start a new log, overwriting whatever the SRAM held.
+void PerfLog_init();
+
+// Add a frame to the log.  Call once per frame after the main loop's work is done, just before SYS_doVBlankProcess.
+void PerfLog_record(u16 scanlines, u16 dmaBytes, u16 seams, u16 lagFrames);
+#else
+#define PerfLog_init()
+#define PerfLog_record(scanlines, dmaBytes, seams, lagFrames)
+#endif
+
+#endif // PERFLOG_H
@@ -0,0 +1,194 @@
+#include <genesis.h>
+#include "MathUtil.h"
+#include "Profiler.h"
+
+#if (PROFILER_ENABLED != 0)
+
+#define NO_COLOUR 0xFFFF
+
+// Backdrop colour while each zone runs (0BGR), or NO_COLOUR to leave it alone.
+const u16 zoneColours[PROFILER_ZONE_COUNT] =
+{
+    NO_COLOUR,  // PROFILER_ZONE_FRAME
+    0x00E0,     // PROFILER_ZONE_JOYPAD: green
+    0x000E,     // PROFILER_ZONE_SCROLLINGMAP: red
+    0x00EE,     // PROFILER_ZONE_DMA_FLUSH: yellow
+    NO_COLOUR   // PROFILER_ZONE_TILE_LOAD
+};
+
+ProfilerZone zones[PROFILER_ZONE_COUNT];
+
+// When each zone last began, in scanlines since vtimer started counting.
+u32 zoneStartTimes[PROFILER_ZONE_COUNT];
+
+// The colour to put back when each zone ends.
+u16 zoneOuterColours[PROFILER_ZONE_COUNT];
+u16 backdropColour;
+
+// The last time read, so that V-counter values which occur twice in a frame can be told apart.
+u32 lastTime;
+
+// Scanlines in vblank, and how the V-counter counts through them.  It starts at 224 (when vtimer is incremented),
+// counts up for firstPassLines lines, then jumps back to secondPassStart and counts up to 255 before the next frame's
+// line 0.  NTSC and PAL differ.
+u16 vblankLines;
+u16 firstPassLines;
+u16 secondPassStart;
+
+u32 readTime(u8* vcounter);
+
+void Profiler_init()
+{
+    if (IS_PALSYSTEM)
+    {
+        vblankLines = 313 - SCREEN_PIXEL_HEIGHT;
+        firstPassLines = 35;  // 0xE0-0xFF, 0x00-0x02
+        secondPassStart = 0xCA;
+    }
+    else
+    {
+        vblankLines = 262 - SCREEN_PIXEL_HEIGHT;
+        firstPassLines = 11;  // 0xE0-0xEA
+        secondPassStart = 0xE5;
+    }
+
+    u16 i;
+    for (i = 0; i < PROFILER_ZONE_COUNT; i++)
+    {
+        ProfilerZone* zone = &zones[i];
+        zone->startVCounter = 0;
+        zone->endVCounter = 0;
+        zone->lastLines = 0;
+        zone->minLines = 0xFFFF;
+        zone->maxLines = 0;
+        zone->totalLines = 0;
+        zone->count = 0;
+    }
+
+    backdropColour = VDP_getPaletteColor(PROFILER_BACKDROP_INDEX);
+    lastTime = 0;
+}
+
+void Profiler_beginZone(u16 zone)
+{
+#if (PROFILER_RASTER_BARS != 0)
+    zoneOuterColours[zone] = backdropColour;
+    if (zoneColours[zone] != NO_COLOUR)
+    {
+        backdropColour = zoneColours[zone];
+        VDP_setPaletteColor(PROFILER_BACKDROP_INDEX, backdropColour);
+    }
+#endif
+
+    zoneStartTimes[zone] = readTime(&zones[zone].startVCounter);
+}
+
+void Profiler_endZone(u16 zone)
+{
+    ProfilerZone* stats = &zones[zone];
+    u32 lines = readTime(&stats->endVCounter) - zoneStartTimes[zone];
+    if (lines > 0xFFFF)
+    {
+        lines = 0xFFFF;
+    }
+
+    stats->lastLines = lines;
+    stats->totalLines += lines;
+    stats->count++;
+
+    if (lines < stats->minLines)
+    {
+        stats->minLines = lines;
+    }
+
+    if (lines > stats->maxLines)
+    {
+        stats->maxLines = lines;
+    }
+
+#if (PROFILER_RASTER_BARS != 0)
+    if (zoneOuterColours[zone] != backdropColour)
+    {
+        backdropColour = zoneOuterColours[zone];
+        VDP_setPaletteColor(PROFILER_BACKDROP_INDEX, backdropColour);
+    }
+#endif
+}
+
+const ProfilerZone* Profiler_getZone(u16 zone)
+{
+    return &zones[zone];
+}
+
+u16 Profiler_getAverageLines(u16 zone)
+{
+    if (zones[zone].count == 0)
+    {
+        return 0;
+    }
+
+    return zones[zone].totalLines / zones[zone].count;
+}
+
+// Returns the time in scanlines since vtimer started counting, and the raw V-counter it was worked out from.
+u32 readTime(u8* vcounter)
+{
+    u32 frame;
+    u16 line;
+    bool inVBlank;
+    bool vintPending;
+
+    // Read again if _VINT counted a frame in the middle.
+    do
+    {
+        frame = vtimer;
+        line = GET_VCOUNTER;
+        inVBlank = (GET_VDP_STATUS(VDP_VBLANK_FLAG) != 0);
+        vintPending = (GET_VDP_STATUS(VDP_VINTPENDING_FLAG) != 0);
+    }
+    while (frame != vtimer);
+
+    // Vblank has started but _VINT hasn't run yet (interrupts are masked, or it's about to), so vtimer is a frame
+    // behind.
+    if (vintPending)
+    {
+        frame++;
+    }
+
+    *vcounter = line;
+
+    u32 frameStart = frame * (SCREEN_PIXEL_HEIGHT + vblankLines);
+    u32 time;
+    if (!inVBlank)
+    {
+        // The frame counts from the start of vblank, so the screen comes after it.
+        time = frameStart + vblankLines + line;
+    }
+    else
+    {
+        u16 firstPass = (line - SCREEN_PIXEL_HEIGHT) & 0xFF;
+        if (line < secondPassStart)
+        {
+            time = frameStart + firstPass;
+        }
+        else if (firstPass >= firstPassLines)
+        {
+            time = frameStart + firstPassLines + line - secondPassStart;
+        }
+        else
+        {
+            // The V-counter passes this value twice during vblank.  Take the first time unless that would be going
+            // backwards.
+            time = frameStart + firstPass;
+            if (time < lastTime)
+            {
+                time = frameStart + firstPassLines + line - secondPassStart;
+            }
+        }
+    }
+
+    lastTime = time;
+    return time;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <genesis.h>
+
+// When nonzero, zones between Profiler_beginZone and Profiler_endZone are timed in scanlines using the VDP's V-counter.
+// When zero, the zone markers compile to nothing.
+#define PROFILER_ENABLED 1
+
+// When nonzero, the backdrop colour changes while each zone runs, so where the CPU time goes shows up on screen as
+// raster bars.  Writing CRAM mid-frame can leave a few stray dots on the screen.
+#define PROFILER_RASTER_BARS 1
+
+// The CRAM slot main.c sets as the background colour.
+#define PROFILER_BACKDROP_INDEX (PAL1 * 16)
+
+// The zones.  PROFILER_ZONE_FRAME covers the whole main loop up to SYS_doVBlankProcess, i.e. all the CPU time used
+// in a frame, and the others go inside it.
+#define PROFILER_ZONE_FRAME 0
+#define PROFILER_ZONE_JOYPAD 1
+#define PROFILER_ZONE_SCROLLINGMAP 2
+#define PROFILER_ZONE_DMA_FLUSH 3
+#define PROFILER_ZONE_TILE_LOAD 4  // Only used by the benchmark
+#define PROFILER_ZONE_COUNT 5
+
+typedef struct
+{
+    // Raw V-counter values at the last Profiler_beginZone and Profiler_endZone.
+    u8 startVCounter;
+    u8 endVCounter;
+
+    // Scanlines the zone took: last time, least, most, and in total over count runs.
+    u16 lastLines;
+    u16 minLines;
+    u16 maxLines;
+    u32 totalLines;
+    u32 count;
+} ProfilerZone;
+
+#if (PROFILER_ENABLED != 0)
+// Clear the statistics.  The backdrop colour should already be set, since zones put it back when they end.
+void Profiler_init();
+
+void Profiler_beginZone(u16 zone);
+void Profiler_endZone(u16 zone);
+
+const ProfilerZone* Profiler_getZone(u16 zone);
+
+// Average scanlines per run of the zone, or 0 if it hasn't run yet.
+u16 Profiler_getAverageLines(u16 zone);
+#else
+#define Profiler_init()
+#define Profiler_beginZone(zone)
+#define Profiler_endZone(zone)
+#endif
+
+#endif // PROFILER_H
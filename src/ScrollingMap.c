@@ -1,22 +1,180 @@
 #include <genesis.h>
+#include "DMAScheduler.h"
 #include "graphics.h"
+#include "mapdata.h"
 #include "MathUtil.h"
 #include "ScrollingMap.h"
+#include "TileDecoder.h"
 
-// TODO -- Background should probably wrap -- at least horizontally if not vertically.
+#if (SCROLLINGMAP_PREBAKED_TILEMAPS != 0)
+#if (TILEMAP_BG_VDP_BASE_TILE != MAP_TILE_START_IDX) || (TILEMAP_FG_VDP_BASE_TILE != MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT)
+#error "mapdata.c doesn't match the tileset layout -- update img/mapdata.txt and rerun tools/MapBaker.py"
+#endif
+#elif (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+#error "SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS requires SCROLLINGMAP_PREBAKED_TILEMAPS"
+#endif
+
+#if (SCROLLINGMAP_COMPRESSED_TILESETS != 0)
+#if (TILESET_BG_LZ_TILE_COUNT != TILESET_BG_TILE_COUNT) || (TILESET_FG_LZ_TILE_COUNT != TILESET_FG_TILE_COUNT)
+#error "mapdata.c's compressed tilesets don't match graphics.c -- rerun tools/MapBaker.py"
+#endif
+#if (TILESET_BG_LZ_BLOCK_TILES > TILEDECODER_MAX_BLOCK_TILES) || (TILESET_FG_LZ_BLOCK_TILES > TILEDECODER_MAX_BLOCK_TILES)
+#error "mapdata.c's compressed tilesets have blocks too big for TileDecoder"
+#endif
+#endif
+
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+#if (SCROLLINGMAP_PREBAKED_TILEMAPS == 0) || (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+#error "SCROLLINGMAP_CHUNKED_MAPS requires SCROLLINGMAP_PREBAKED_TILEMAPS and can't be used with SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS"
+#endif
+#if (SCROLLINGMAP_CHUNK_TILES != 16) || (SCROLLINGMAP_METATILE_TILES != 2)
+#error "The chunk decoder only handles 16x16 tile chunks of 2x2 tile metatiles"
+#endif
+#if (TILEMAP_FG_CHUNKED_LAYOUT_WIDTH * SCROLLINGMAP_CHUNK_TILES < TILEMAP_FG_TILE_WIDTH) || (TILEMAP_BG_CHUNKED_LAYOUT_WIDTH * SCROLLINGMAP_CHUNK_TILES < TILEMAP_BG_TILE_WIDTH)
+#error "mapdata.c chunks don't match SCROLLINGMAP_CHUNK_TILES -- rerun tools/MapBaker.py"
+#endif
+#endif
+
+// The background map has to cover everything the background camera can reach, given how far the foreground camera can
+// go and the background's parallax ratio.
+#define BG_MAP_PIXELS_NEEDED(fgMapPixels, screenPixels, ratio) (((((fgMapPixels) - (screenPixels)) * (ratio)) >> FIX16_FRAC_BITS) + (screenPixels))
+
+#if (SCROLLINGMAP_BG_WRAP_X == 0) && (TILE_TO_PIXEL(TILEMAP_BG_TILE_WIDTH) < BG_MAP_PIXELS_NEEDED(TILE_TO_PIXEL(TILEMAP_FG_TILE_WIDTH), SCREEN_PIXEL_WIDTH, SCROLLINGMAP_BG_RATIO_X))
+#error "Background map is too narrow for SCROLLINGMAP_BG_RATIO_X"
+#endif
+
+#if (SCROLLINGMAP_BG_WRAP_Y == 0) && (TILE_TO_PIXEL(TILEMAP_BG_TILE_HEIGHT) < BG_MAP_PIXELS_NEEDED(TILE_TO_PIXEL(TILEMAP_FG_TILE_HEIGHT), SCREEN_PIXEL_HEIGHT, SCROLLINGMAP_BG_RATIO_Y))
+#error "Background map is too short for SCROLLINGMAP_BG_RATIO_Y"
+#endif
+
+// Rows can be DMA'd straight from the map when it's flat and already holds name-table words.  Otherwise they're built
+// in staging RAM first.
+#define SCROLLINGMAP_ROWS_FROM_ROM ((SCROLLINGMAP_PREBAKED_TILEMAPS != 0) && (SCROLLINGMAP_CHUNKED_MAPS == 0))
+
+// Plane rows loadScreen builds and sends at a time: as many as fit in the staging RAM.
+#define LOAD_ROWS_PER_DMA (DMA_STAGING_SIZE / VDP_PLANE_TILE_WIDTH_TIMES_TWO)
+
+#if (LOAD_ROWS_PER_DMA == 0) || (VDP_PLANE_TILE_HEIGHT % LOAD_ROWS_PER_DMA != 0)
+#error "DMA_STAGING_SIZE has to hold a whole number of plane rows that divides the plane height"
+#endif
+
+#if (SCROLLINGMAP_PREFETCH_COLUMNS > VDP_PLANE_TILE_WIDTH - SCREEN_TILE_WIDTH_PLUS_ONE) || (SCROLLINGMAP_PREFETCH_ROWS > VDP_PLANE_TILE_HEIGHT - SCREEN_TILE_HEIGHT_PLUS_ONE)
+#error "Can't prefetch more tiles than the plane has room for beyond the screen"
+#endif
+
+#if (SCREEN_TILE_WIDTH_PLUS_ONE + (SCROLLINGMAP_SEAM_MARGIN_COLUMNS * 2) > VDP_PLANE_TILE_WIDTH) || (SCREEN_TILE_HEIGHT_PLUS_ONE + (SCROLLINGMAP_SEAM_MARGIN_ROWS * 2) > VDP_PLANE_TILE_HEIGHT)
+#error "Seam margins are wider than the plane has room for"
+#endif
+
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+#if (SCROLLINGMAP_FG_BACK_PLANE_ADDR == 0) || ((SCROLLINGMAP_FG_BACK_PLANE_ADDR & 0x1FFF) != 0) || ((SCROLLINGMAP_BG_BACK_PLANE_ADDR & 0x1FFF) != 0)
+#error "Back name tables have to start on an 8KB boundary"
+#endif
+#if ((MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT + TILESET_FG_TILE_COUNT) * 32 > SCROLLINGMAP_FG_BACK_PLANE_ADDR) || (SCROLLINGMAP_BG_BACK_PLANE_ADDR != 0 && (MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT + TILESET_FG_TILE_COUNT) * 32 > SCROLLINGMAP_BG_BACK_PLANE_ADDR)
+#error "The tilesets run into a back name table"
+#endif
+#endif
 
 // NOTE: While not a direct port from the original, the structure and techniques used here were inspired from
 // sikthehedgehog's Dragon's Castle.
 //
 // https://github.com/sikthehedgehog/dragon/blob/master/src-68k/stage.68k
 
-// NOTE: Width of background map must be ((width of foreground map / 2) + 160).
-// NOTE: Height of background map must be ((height of foreground map / 2) + 112).
 // NOTE: Assumes background will each only use one palette.  Sonic 2's foregrounds can use at least 2.
 
 #define PLANE_FG VDP_BG_A
 #define PLANE_BG VDP_BG_B
 
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+// One row of a chunk, decoded into name-table words.
+typedef struct
+{
+    u16 chunkColumn;  // CHUNK_ROW_EMPTY if the slot hasn't been used yet
+    u16 row;          // Map row
+    u16 tiles[SCROLLINGMAP_CHUNK_TILES];
+} ChunkRow;
+
+#define CHUNK_ROW_EMPTY 0xFFFF
+#endif
+
+#define LAYER_UNBOUNDED 0xFFFF
+
+// Everything needed to keep one plane in sync with its map.
+typedef struct
+{
+    // VRAM address of the plane's name table.
+    u16 planeAddr;
+
+    // Where this plane's seams go in the DMA scheduler's pecking order.
+    u16 dmaPriority;
+
+    u16 mapTileWidth;
+    u16 mapTileHeight;
+
+    // How far layer coordinates go along each axis: the map size, or LAYER_UNBOUNDED if the map wraps.  Coordinates
+    // past the map size are wrapped back onto it when reading the map.
+    u16 extentTileWidth;
+    u16 extentTileHeight;
+
+    // Set when the map wraps and repeats a whole number of times across the plane, so a plane full of it stays valid
+    // wherever the camera goes along that axis.
+    bool periodicX;
+    bool periodicY;
+
+    // Start of each map row, from mapdata.c.
+    const u16* const* rows;
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+    // The same map stored column by column.
+    const u16* columns;
+#endif
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+    // The map as chunks instead.  See tools/MapBaker.py.
+    const u16* layout;
+    const u16* chunks;
+    const u16* metatiles;
+    u16 layoutWidth;
+
+    // Recently decoded chunk rows.  See getChunkRow.
+    ChunkRow chunkRowCache[SCROLLINGMAP_CHUNK_CACHE_COLUMNS * VDP_PLANE_TILE_HEIGHT];
+#endif
+
+    // Added to each map entry to get the VDP name-table word.  Zero when the maps are prebaked.
+    u16 baseTile;
+
+    // Scroll rate relative to the foreground camera.
+    fix16 ratioX;
+    fix16 ratioY;
+
+    // The map pixel at the top left of the screen, and the furthest it can go without showing past the map edges.
+    u32 cameraPixelX;
+    u32 cameraPixelY;
+    u32 cameraLimitPixelX;
+    u32 cameraLimitPixelY;
+
+    // Coordinates of the tile at the top left of the screen.
+    u16 cameraTileX;
+    u16 cameraTileY;
+
+    // Number of map columns that can be on screen from cameraTileX onwards.  More than the screen width when
+    // line-scroll bands show different parts of the map.
+    u16 viewTileWidth;
+
+    // Set while the screen is being redrawn a few columns at a time.  See SCROLLINGMAP_INCREMENTAL_REDRAW.
+    bool redrawing;
+
+    // Direction the camera last moved in along each axis (1 or -1), so quiet frames know which way to prefetch.
+    s16 directionX;
+    s16 directionY;
+
+    // The part of the map currently held in the plane.  Every tile in columns [residentColumnStart, residentColumnEnd)
+    // and rows [residentRowStart, residentRowEnd) is up to date in VRAM and doesn't need to be drawn again while it
+    // stays there.  Empty when residentColumnStart == residentColumnEnd.
+    u16 residentColumnStart;
+    u16 residentColumnEnd;
+    u16 residentRowStart;
+    u16 residentRowEnd;
+} MapLayer;
+
 // The maximum coordinates (towards the bottom right) where the camera can be without showing anything beyond the map edges.
 u32 fgCameraLimitPixelX;
 u32 fgCameraLimitPixelY;
@@ -25,322 +183,1571 @@ u32 fgCameraLimitPixelY;
 u32 fgCameraPixelX;
 u32 fgCameraPixelY;
 
-// Coordinates of the tile containing fgCameraPixelX and fgCameraPixelY.
-u16 fgCameraTileX;
-u16 fgCameraTileY;
-
-// Coordinates of the tile at the top left of the background.  Background scrolls at half the rate of the foreground.
-u16 bgCameraTileX;
-u16 bgCameraTileY;
+// Background scrolls at SCROLLINGMAP_BG_RATIO_X/Y of the foreground's rate, or horizontally according to bgBands.
+MapLayer fgLayer;
+MapLayer bgLayer;
 
-// Buffers used for copying map data to VRAM.
-u16 fgRowBuffer[VDP_PLANE_TILE_WIDTH];
-u16 fgColumnBuffer[VDP_PLANE_TILE_HEIGHT];
-u16 bgRowBuffer[VDP_PLANE_TILE_WIDTH];
-u16 bgColumnBuffer[VDP_PLANE_TILE_HEIGHT];
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+// The views being built in the back name tables for ScrollingMap_cut.  Their planeAddr is always the back table, and
+// bgBackLayer is only used if the background has one.
+MapLayer fgBackLayer;
+MapLayer bgBackLayer;
 
-u16 fgMapTileWidth;
-u16 fgMapTileHeight;
-const u16* fgMapTilemap;
-
-u16 bgMapTileWidth;
-u16 bgMapTileHeight;
-const u16* bgMapTilemap;
+// Set from ScrollingMap_prepareCut until ScrollingMap_cut.
+bool cutPrepared;
+u32 cutCameraPixelX;
+u32 cutCameraPixelY;
 
+// Set by ScrollingMap_cut until ScrollingMap_updateVDP points the VDP at the new tables.
+bool planesFlipped;
+#endif
 
 u16 fgTilesetStartIdx;
 u16 bgTilesetStartIdx;
 
-void redrawForegroundRow(u16 rowToUpdate);
-void redrawBackgroundRow(u16 rowToUpdate);
-void redrawForegroundColumn(u16 columnToUpdate);
-void redrawBackgroundColumn(u16 columnToUpdate);
-void redrawForegroundScreen();
-void redrawBackgroundScreen();
-void updateCamera();
+ParallaxBand bgBands[SCROLLINGMAP_MAX_PARALLAX_BANDS];
+u16 bgBandCount;
+
+// How far each background band has scrolled, in pixels.  bgLayer.cameraPixelX is the least of these.
+u32 bgBandPixelX[SCROLLINGMAP_MAX_PARALLAX_BANDS];
+
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+// H-scroll table entries for each screen line, as last queued for DMA.
+s16 fgLineScroll[SCREEN_PIXEL_HEIGHT];
+s16 bgLineScroll[SCREEN_PIXEL_HEIGHT];
+
+// Set when the whole table has to be sent again.
+bool lineScrollDirty;
+#endif
+
+// Rows and columns drawn by the last ScrollingMap_update.
+u16 seamsDrawn;
+
+// Past this many missing rows or columns, a plane is redrawn from scratch instead.  Normally
+// SCROLLINGMAP_MAX_SEAMS_PER_FRAME, but SCROLLINGMAP_LAG_POLICY_CATCH_UP raises it after a lag frame.
+u16 seamLimit;
+
+u16 lagPolicy;
+u32 lastUpdateVTimer;
+u16 lagFrames;
+u32 totalLagFrames;
+
+void initLayer(MapLayer* layer, u16 planeAddr, u16 dmaPriority, u16 mapTileWidth, u16 mapTileHeight, fix16 ratioX, fix16 ratioY, bool wrapX, bool wrapY);
+bool updateLayer(MapLayer* layer, u16 oldCameraTileX, u16 oldCameraTileY, u16 dmaPriority);
+void prefetchLayer(MapLayer* layer);
+bool redrawRow(MapLayer* layer, u16 rowToUpdate, u16 firstColumn, u16 tileCount, u16 dmaPriority);
+bool redrawColumn(MapLayer* layer, u16 columnToUpdate, u16 firstRow, u16 tileCount, u16 dmaPriority);
+void redrawScreen(MapLayer* layer);
+void loadScreen(MapLayer* layer);
+void startRedraw(MapLayer* layer, u16 visibleColumnEnd);
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+void startBackLayer(MapLayer* backLayer, const MapLayer* layer);
+void buildBackLayer(MapLayer* layer);
+void flipLayer(MapLayer* layer, MapLayer* backLayer);
+#endif
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+void dmaMapColumn(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount, bool immediate);
+#endif
+void fetchRow(MapLayer* layer, u16 row, u16 firstColumn, u16 tileCount, u16* buffer);
+void fetchColumn(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount, u16* buffer);
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+const u16* getChunkRow(MapLayer* layer, u16 chunkColumn, u16 row);
+#endif
+u16 wrapColumn(MapLayer* layer, u16 column);
+u16 wrapRow(MapLayer* layer, u16 row);
+bool isRowResident(MapLayer* layer, u16 row);
+bool isColumnResident(MapLayer* layer, u16 column);
+void markRowResident(MapLayer* layer, u16 row, u16 firstColumn, u16 tileCount);
+void markColumnResident(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount);
+void normalizeResident(MapLayer* layer);
+void getRowSpan(MapLayer* layer, u16* firstColumn, u16* tileCount);
+void getColumnSpan(MapLayer* layer, u16* firstRow, u16* tileCount);
+u16 getVisibleColumnEnd(MapLayer* layer);
+void getPrefetchRowSpan(MapLayer* layer, u16* firstColumn, u16* tileCount);
+void getPrefetchColumnSpan(MapLayer* layer, u16* firstRow, u16* tileCount);
+void updateCamera(bool updateBackground);
+void updateLayerCamera(MapLayer* layer, u32 cameraPixelX, u32 cameraPixelY);
+void updateBandCamera(MapLayer* layer, u32 cameraPixelX, u32* bandPixelX);
+u32 scaleCameraPixel(u32 cameraPixel, fix16 ratio, u32 limit);
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+void updateLineScroll();
+void queueLineScroll(s16* lineScroll, u16 planeOffset, u16 startLine, u16 endLine, s16 value);
+#endif
+void queueRowDma(u16 planeRowAddr, const u16* mapDataAddr, u16 firstColumn, u16 tileCount);
+void dmaColumn(u16 planeColumnAddr, const u16* mapDataAddr, u16 firstRow, u16 tileCount, bool immediate);
 
 void ScrollingMap_init()
 {
     VDP_setPlanSize(VDP_PLANE_TILE_WIDTH, VDP_PLANE_TILE_HEIGHT);
 
-    fgMapTileWidth = TILEMAP_FG_TILE_WIDTH;
-    fgMapTileHeight = TILEMAP_FG_TILE_HEIGHT;
-    fgMapTilemap = (u16*) TILEMAP_FG;
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+    // A cut may have left a plane on its back table, in which case the table it started on is the back layer's now.
+    if (PLANE_FG == SCROLLINGMAP_FG_BACK_PLANE_ADDR)
+    {
+        VDP_setBGAAddress(fgBackLayer.planeAddr);
+    }
+
+    if (SCROLLINGMAP_BG_BACK_PLANE_ADDR != 0 && PLANE_BG == SCROLLINGMAP_BG_BACK_PLANE_ADDR)
+    {
+        VDP_setBGBAddress(bgBackLayer.planeAddr);
+    }
+
+    fgBackLayer.planeAddr = SCROLLINGMAP_FG_BACK_PLANE_ADDR;
+    bgBackLayer.planeAddr = SCROLLINGMAP_BG_BACK_PLANE_ADDR;
+    cutPrepared = FALSE;
+    planesFlipped = FALSE;
+#endif
 
-    bgMapTileWidth = TILEMAP_BG_TILE_WIDTH;
-    bgMapTileHeight = TILEMAP_BG_TILE_HEIGHT;
-    bgMapTilemap = (u16*) TILEMAP_BG;
+    // The background moves slower, so it can usually stand to have a seam arrive a frame late.
+    initLayer(&fgLayer, PLANE_FG, DMA_PRIORITY_FG, TILEMAP_FG_TILE_WIDTH, TILEMAP_FG_TILE_HEIGHT, SCROLLINGMAP_RATIO(1, 1), SCROLLINGMAP_RATIO(1, 1), FALSE, FALSE);
+    initLayer(&bgLayer, PLANE_BG, DMA_PRIORITY_BG, TILEMAP_BG_TILE_WIDTH, TILEMAP_BG_TILE_HEIGHT, SCROLLINGMAP_BG_RATIO_X, SCROLLINGMAP_BG_RATIO_Y,
+        SCROLLINGMAP_BG_WRAP_X != 0, SCROLLINGMAP_BG_WRAP_Y != 0);
+
+    bgBands[0].startLine = 0;
+    bgBands[0].ratio = bgLayer.ratioX;
+    bgBandCount = 1;
 
     // TODO -- Initialize the camera's position based on the player's starting position.
     fgCameraPixelX = 0;
     fgCameraPixelY = 0;
-    fgCameraLimitPixelX = TILE_TO_PIXEL(fgMapTileWidth) - SCREEN_PIXEL_WIDTH;
-    fgCameraLimitPixelY = TILE_TO_PIXEL(fgMapTileHeight) - SCREEN_PIXEL_HEIGHT;
+    fgCameraLimitPixelX = fgLayer.cameraLimitPixelX;
+    fgCameraLimitPixelY = fgLayer.cameraLimitPixelY;
 
     // Load tiles
     bgTilesetStartIdx = MAP_TILE_START_IDX;
     fgTilesetStartIdx = MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT;
 
+#if (SCROLLINGMAP_COMPRESSED_TILESETS != 0)
+    // Decoding needs a whole block's worth of staging RAM.  Init is called between frames, so whatever the last frame
+    // staged has been sent; giving it back leaves the staging RAM empty, since nothing queues tiles from it.
+    DMAScheduler_releaseStaging();
+    if (!TileDecoder_loadTiles(TILESET_BG_LZ, TILESET_BG_LZ_BLOCKS, TILESET_BG_LZ_TILE_COUNT, TILESET_BG_LZ_BLOCK_TILES,
+            bgTilesetStartIdx)
+        || !TileDecoder_loadTiles(TILESET_FG_LZ, TILESET_FG_LZ_BLOCKS, TILESET_FG_LZ_TILE_COUNT,
+            TILESET_FG_LZ_BLOCK_TILES, fgTilesetStartIdx))
+    {
+        SYS_die("ScrollingMap_init: no staging RAM to decode the tilesets in");
+    }
+#else
     VDP_loadTileData((const u32*) TILESET_BG, bgTilesetStartIdx, TILESET_BG_TILE_COUNT, 0);
     VDP_loadTileData((const u32*) TILESET_FG, fgTilesetStartIdx, TILESET_FG_TILE_COUNT, 0);
+#endif
 
-    // Calculate row offsets so we don't need to multiply later.
-    u16 rowOffset = 0;
-    u16 i;
-    for (i = 0; i < fgMapTileHeight; i++)
+#if (SCROLLINGMAP_PREBAKED_TILEMAPS != 0)
+    fgLayer.rows = (const u16* const*) TILEMAP_FG_VDP_ROWS;
+    bgLayer.rows = (const u16* const*) TILEMAP_BG_VDP_ROWS;
+    fgLayer.baseTile = 0;
+    bgLayer.baseTile = 0;
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+    fgLayer.columns = (u16*) TILEMAP_FG_VDP_COLUMNS;
+    bgLayer.columns = (u16*) TILEMAP_BG_VDP_COLUMNS;
+#endif
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+    fgLayer.layout = (u16*) TILEMAP_FG_CHUNKED_LAYOUT;
+    fgLayer.chunks = (u16*) TILEMAP_FG_CHUNKED_CHUNKS;
+    fgLayer.metatiles = (u16*) TILEMAP_FG_CHUNKED_METATILES;
+    fgLayer.layoutWidth = TILEMAP_FG_CHUNKED_LAYOUT_WIDTH;
+    bgLayer.layout = (u16*) TILEMAP_BG_CHUNKED_LAYOUT;
+    bgLayer.chunks = (u16*) TILEMAP_BG_CHUNKED_CHUNKS;
+    bgLayer.metatiles = (u16*) TILEMAP_BG_CHUNKED_METATILES;
+    bgLayer.layoutWidth = TILEMAP_BG_CHUNKED_LAYOUT_WIDTH;
+#endif
+#else
+    fgLayer.rows = (const u16* const*) TILEMAP_FG_ROWS;
+    bgLayer.rows = (const u16* const*) TILEMAP_BG_ROWS;
+    fgLayer.baseTile = TILE_ATTR_FULL(PAL1, 0, 0, 0, fgTilesetStartIdx);
+    bgLayer.baseTile = TILE_ATTR_FULL(PAL0, 0, 0, 0, bgTilesetStartIdx);
+#endif
+
+    seamLimit = SCROLLINGMAP_MAX_SEAMS_PER_FRAME;
+    lagPolicy = SCROLLINGMAP_LAG_POLICY_NONE;
+    lastUpdateVTimer = vtimer;
+    lagFrames = 0;
+    totalLagFrames = 0;
+
+    updateCamera(TRUE);
+    ScrollingMap_updateVDP();
+    loadScreen(&fgLayer);
+    loadScreen(&bgLayer);
+
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    lineScrollDirty = TRUE;
+    updateLineScroll();
+#endif
+}
+
+void ScrollingMap_setParallaxBands(const ParallaxBand* bands, u16 bandCount)
+{
+    if (bandCount > SCROLLINGMAP_MAX_PARALLAX_BANDS)
     {
-        fgRowOffsets[i] = rowOffset;
-        rowOffset += fgMapTileWidth;
+        bandCount = SCROLLINGMAP_MAX_PARALLAX_BANDS;
     }
 
-    rowOffset = 0;
-    for (i = 0; i < bgMapTileHeight; i++)
+    u16 i;
+    for (i = 0; i < bandCount; i++)
     {
-        bgRowOffsets[i] = rowOffset;
-        rowOffset += bgMapTileWidth;
+        bgBands[i] = bands[i];
     }
+    bgBandCount = bandCount;
 
-    updateCamera();
-    ScrollingMap_updateVDP();
-    redrawForegroundScreen();
-    redrawBackgroundScreen();
+    // The background's seams and scroll table catch up on the next update.
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    lineScrollDirty = TRUE;
+#endif
 }
 
-void ScrollingMap_update()
+void initLayer(MapLayer* layer, u16 planeAddr, u16 dmaPriority, u16 mapTileWidth, u16 mapTileHeight, fix16 ratioX, fix16 ratioY, bool wrapX, bool wrapY)
 {
-    u16 oldFGCameraTileX = fgCameraTileX;
-    u16 oldFGCameraTileY = fgCameraTileY;
-    u16 oldBGCameraTileX = bgCameraTileX;
-    u16 oldBGCameraTileY = bgCameraTileY;
+    layer->planeAddr = planeAddr;
+    layer->dmaPriority = dmaPriority;
+    layer->mapTileWidth = mapTileWidth;
+    layer->mapTileHeight = mapTileHeight;
+    layer->ratioX = ratioX;
+    layer->ratioY = ratioY;
 
-    updateCamera();
-
-    // Foreground
-    if (fgCameraTileX < oldFGCameraTileX)
+    if (wrapX)
     {
-        // Moved left.
-        redrawForegroundColumn(fgCameraTileX);
+        layer->extentTileWidth = LAYER_UNBOUNDED;
+        layer->cameraLimitPixelX = 0xFFFFFFFF;
+        layer->periodicX = (VDP_PLANE_TILE_WIDTH % mapTileWidth) == 0;
     }
-    else if (fgCameraTileX > oldFGCameraTileX)
+    else
     {
-        // Moved right.
-        redrawForegroundColumn(fgCameraTileX + SCREEN_TILE_WIDTH);
+        layer->extentTileWidth = mapTileWidth;
+        layer->cameraLimitPixelX = TILE_TO_PIXEL(mapTileWidth) - SCREEN_PIXEL_WIDTH;
+        layer->periodicX = FALSE;
     }
 
-    if (fgCameraTileY < oldFGCameraTileY)
+    if (wrapY)
     {
-        // Moved up.
-        redrawForegroundRow(fgCameraTileY);
+        layer->extentTileHeight = LAYER_UNBOUNDED;
+        layer->cameraLimitPixelY = 0xFFFFFFFF;
+        layer->periodicY = (VDP_PLANE_TILE_HEIGHT % mapTileHeight) == 0;
     }
-    else if (fgCameraTileY > oldFGCameraTileY)
+    else
     {
-        // Moved down.
-        redrawForegroundRow(fgCameraTileY + SCREEN_TILE_HEIGHT);
+        layer->extentTileHeight = mapTileHeight;
+        layer->cameraLimitPixelY = TILE_TO_PIXEL(mapTileHeight) - SCREEN_PIXEL_HEIGHT;
+        layer->periodicY = FALSE;
     }
+    layer->viewTileWidth = SCREEN_TILE_WIDTH_PLUS_ONE;
+
+    // Nothing has been drawn yet.
+    layer->residentColumnStart = 0;
+    layer->residentColumnEnd = 0;
+    layer->residentRowStart = 0;
+    layer->residentRowEnd = 0;
+    layer->redrawing = FALSE;
 
-    // Background
-    if (bgCameraTileX < oldBGCameraTileX)
+    // Most of the game scrolls to the right.
+    layer->directionX = 1;
+    layer->directionY = 1;
+
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+    u16 i;
+    for (i = 0; i < SCROLLINGMAP_CHUNK_CACHE_COLUMNS * VDP_PLANE_TILE_HEIGHT; i++)
     {
-        // Moved left.
-        redrawBackgroundColumn(bgCameraTileX);
+        layer->chunkRowCache[i].chunkColumn = CHUNK_ROW_EMPTY;
     }
-    else if (bgCameraTileX > oldBGCameraTileX)
+#endif
+}
+
+void ScrollingMap_update()
+{
+    u16 oldFGCameraTileX = fgLayer.cameraTileX;
+    u16 oldFGCameraTileY = fgLayer.cameraTileY;
+    u16 oldBGCameraTileX = bgLayer.cameraTileX;
+    u16 oldBGCameraTileY = bgLayer.cameraTileY;
+
+    // vtimer goes up once per vblank, so anything more than one since the last update means the main loop missed one.
+    u32 elapsedFrames = vtimer - lastUpdateVTimer;
+    lastUpdateVTimer = vtimer;
+    lagFrames = (elapsedFrames > 1) ? elapsedFrames - 1 : 0;
+    totalLagFrames += lagFrames;
+
+    bool updateBackground = TRUE;
+    u16 bgDmaPriority = bgLayer.dmaPriority;
+    seamLimit = SCROLLINGMAP_MAX_SEAMS_PER_FRAME;
+
+    if (lagFrames != 0)
     {
-        // Moved right.
-        redrawBackgroundColumn(bgCameraTileX + SCREEN_TILE_WIDTH);
+        if (lagPolicy == SCROLLINGMAP_LAG_POLICY_SKIP_BACKGROUND)
+        {
+            updateBackground = FALSE;
+        }
+        else if (lagPolicy == SCROLLINGMAP_LAG_POLICY_CATCH_UP)
+        {
+            seamLimit *= 1 + ((lagFrames < SCROLLINGMAP_MAX_CATCH_UP_FRAMES) ? lagFrames : SCROLLINGMAP_MAX_CATCH_UP_FRAMES);
+            bgDmaPriority = DMA_PRIORITY_FG;
+        }
     }
 
-    if (bgCameraTileY < oldBGCameraTileY)
+    seamsDrawn = 0;
+    updateCamera(updateBackground);
+
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    // The scroll table always goes out, so claim its share of the DMA budget before any seams are weighed against it.
+    updateLineScroll();
+#endif
+
+    // A plane with a cut being prepared spends the frames it needs no seams on that instead of prefetching.
+    if (!updateLayer(&fgLayer, oldFGCameraTileX, oldFGCameraTileY, fgLayer.dmaPriority))
     {
-        // Moved up.
-        redrawBackgroundRow(bgCameraTileY);
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+        if (cutPrepared)
+        {
+            buildBackLayer(&fgBackLayer);
+        }
+        else
+#endif
+        {
+            prefetchLayer(&fgLayer);
+        }
     }
-    else if (bgCameraTileY > oldBGCameraTileY)
+
+    if (updateBackground && !updateLayer(&bgLayer, oldBGCameraTileX, oldBGCameraTileY, bgDmaPriority))
     {
-        // Moved down.
-        redrawBackgroundRow(bgCameraTileY + SCREEN_TILE_HEIGHT);
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+        if (cutPrepared && bgBackLayer.planeAddr != 0)
+        {
+            buildBackLayer(&bgBackLayer);
+        }
+        else
+#endif
+        {
+            prefetchLayer(&bgLayer);
+        }
     }
 }
 
-void ScrollingMap_updateVDP()
+u16 ScrollingMap_getSeamsDrawn()
+{
+    return seamsDrawn;
+}
+
+bool ScrollingMap_isRedrawing()
+{
+    return fgLayer.redrawing || bgLayer.redrawing;
+}
+
+void ScrollingMap_setLagPolicy(u16 policy)
+{
+    lagPolicy = policy;
+}
+
+u16 ScrollingMap_getLagFrames()
 {
-    // Foreground
-    VDP_setHorizontalScroll(BG_A, -fgCameraPixelX);
-    VDP_setVerticalScroll(BG_A, fgCameraPixelY);
+    return lagFrames;
+}
 
-    // Background, scrolls at half the rate.
-    VDP_setHorizontalScroll(BG_B, -(fgCameraPixelX >> 1));
-    VDP_setVerticalScroll(BG_B, (fgCameraPixelY >> 1));
+u32 ScrollingMap_getTotalLagFrames()
+{
+    return totalLagFrames;
 }
 
-void redrawForegroundRow(u16 rowToUpdate)
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+void ScrollingMap_prepareCut(u32 cameraPixelX, u32 cameraPixelY)
 {
-    // Calculate where in the tilemap the new row's tiles are located.
-    const u16* mapDataAddr = fgMapTilemap + fgRowOffsets[rowToUpdate] + fgCameraTileX;
+    // Kept within the map, as the camera itself is.
+    cutCameraPixelX = (cameraPixelX > fgCameraLimitPixelX) ? fgCameraLimitPixelX : cameraPixelX;
+    cutCameraPixelY = (cameraPixelY > fgCameraLimitPixelY) ? fgCameraLimitPixelY : cameraPixelY;
+    cutPrepared = TRUE;
 
-    u16 rowBufferIdx = fgCameraTileX;
-    u16 baseTile = TILE_ATTR_FULL(PAL1, 0, 0, 0, fgTilesetStartIdx);
+    startBackLayer(&fgBackLayer, &fgLayer);
+    updateLayerCamera(&fgBackLayer, cutCameraPixelX, cutCameraPixelY);
+    startRedraw(&fgBackLayer, getVisibleColumnEnd(&fgBackLayer));
 
-    // Copy the tiles into the buffer.
-    u16 i;
-    for (i = VDP_PLANE_TILE_WIDTH; i != 0; i--)
+    if (bgBackLayer.planeAddr != 0)
     {
-        rowBufferIdx &= 0x3F;  // rowBufferIdx MOD 64 (VDP_PLANE_TILE_WIDTH)
-        // TODO -- Need to determine which is better -- rowBuffer[rowBufferIdx] or *(rowBuffer + rowBufferIdx).
-        fgRowBuffer[rowBufferIdx] = baseTile + *mapDataAddr;
-        rowBufferIdx++;
-        mapDataAddr++;
+        // The bands' own positions are worked out again at the cut.
+        u32 bandPixelX[SCROLLINGMAP_MAX_PARALLAX_BANDS];
+        startBackLayer(&bgBackLayer, &bgLayer);
+        updateLayerCamera(&bgBackLayer, cutCameraPixelX, cutCameraPixelY);
+        updateBandCamera(&bgBackLayer, cutCameraPixelX, bandPixelX);
+        startRedraw(&bgBackLayer, getVisibleColumnEnd(&bgBackLayer));
     }
+}
 
-    // Queue copying the buffer into VRAM.
-    DMA_queueDma(DMA_VRAM, (void*) fgRowBuffer, PLANE_FG + ((((rowToUpdate & VDP_PLANE_TILE_HEIGHT_MINUS_ONE) << 6)) << 1), VDP_PLANE_TILE_WIDTH, 2);
+bool ScrollingMap_isCutReady()
+{
+    return cutPrepared && !fgBackLayer.redrawing && !(bgBackLayer.planeAddr != 0 && bgBackLayer.redrawing);
 }
 
-void redrawBackgroundRow(u16 rowToUpdate)
+void ScrollingMap_cut()
 {
-    // Calculate where in the tilemap the new row's tiles are located.
-    const u16* mapDataAddr = bgMapTilemap + bgRowOffsets[rowToUpdate] + bgCameraTileX;
+    if (!cutPrepared)
+    {
+        return;
+    }
 
-    u16 rowBufferIdx = bgCameraTileX;
-    u16 baseTile = TILE_ATTR_FULL(PAL0, 0, 0, 0, bgTilesetStartIdx);
+    cutPrepared = FALSE;
+    fgCameraPixelX = cutCameraPixelX;
+    fgCameraPixelY = cutCameraPixelY;
 
-    // Copy the tiles into the buffer.
-    u16 i;
-    for (i = VDP_PLANE_TILE_WIDTH; i != 0; i--)
+    flipLayer(&fgLayer, &fgBackLayer);
+    if (bgBackLayer.planeAddr != 0)
     {
-        rowBufferIdx &= 0x3F;  // rowBufferIdx MOD 64 (VDP_PLANE_TILE_WIDTH)
-        // TODO -- Need to determine which is better -- rowBuffer[rowBufferIdx] or *(rowBuffer + rowBufferIdx).
-        bgRowBuffer[rowBufferIdx] = baseTile + *mapDataAddr;
-        rowBufferIdx++;
-        mapDataAddr++;
+        flipLayer(&bgLayer, &bgBackLayer);
     }
 
-    // Queue copying the buffer into VRAM.
-    DMA_queueDma(DMA_VRAM, (void*) bgRowBuffer, PLANE_BG + ((((rowToUpdate & VDP_PLANE_TILE_HEIGHT_MINUS_ONE) << 6)) << 1), VDP_PLANE_TILE_WIDTH, 2);
+    // Brings the background's bands up to date even if the lag policy skips it this update.  A background without a
+    // back table is left where it was for ScrollingMap_update to redraw.
+    updateCamera(bgBackLayer.planeAddr != 0);
+    planesFlipped = TRUE;
+}
+
+// Start a back layer off as a copy of the layer on show, apart from which table it draws into.
+void startBackLayer(MapLayer* backLayer, const MapLayer* layer)
+{
+    u16 planeAddr = backLayer->planeAddr;
+    *backLayer = *layer;
+    backLayer->planeAddr = planeAddr;
 }
 
-void redrawForegroundColumn(u16 columnToUpdate)
+// Draw the next few columns of a view being prepared for a cut, right and left of the middle in turn like a redraw on
+// show, in DMA budget nothing else wants.  Only on frames the plane on show needs no seams, so the two together never
+// fill SGDK's DMA queue.  Clears redrawing once the whole view is there.
+void buildBackLayer(MapLayer* layer)
 {
-    // Calculate where in the tilemap the new row's tiles are located.
-    const u16* mapDataAddr = fgMapTilemap + fgRowOffsets[fgCameraTileY] + columnToUpdate;
+    if (!layer->redrawing)
+    {
+        return;
+    }
 
-    u16 columnBufferIdx = fgCameraTileY;
-    u16 baseTile = TILE_ATTR_FULL(PAL1, 0, 0, 0, fgTilesetStartIdx);
+    u16 visibleColumnEnd = getVisibleColumnEnd(layer);
+    u16 firstRow;
+    u16 tileCount;
+    getColumnSpan(layer, &firstRow, &tileCount);
 
-    // Copy the tiles into the buffer.
-    u16 i;
-    for (i = VDP_PLANE_TILE_HEIGHT; i != 0; i--)
+    bool right = TRUE;
+    u16 columnsLeft = SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME;
+    while (TRUE)
+    {
+        bool rightMissing = layer->residentColumnEnd < visibleColumnEnd;
+        bool leftMissing = layer->residentColumnStart > layer->cameraTileX;
+        if (!rightMissing && !leftMissing)
+        {
+            layer->redrawing = FALSE;
+            return;
+        }
+
+        right = rightMissing && (right || !leftMissing);
+        u16 column = right ? layer->residentColumnEnd : layer->residentColumnStart - 1;
+        if (columnsLeft == 0 || !redrawColumn(layer, column, firstRow, tileCount, DMA_PRIORITY_PREFETCH))
+        {
+            return;
+        }
+
+        right = !right;
+        columnsLeft--;
+    }
+}
+
+// Show a back layer's view in place of the layer's, drawing whatever's still missing first.  The table that was on
+// show becomes the back layer's.
+void flipLayer(MapLayer* layer, MapLayer* backLayer)
+{
+    if (backLayer->redrawing)
     {
-        columnBufferIdx &= 0x1F;  // columnBufferIdx MOD 32 (VDP_PLANE_TILE_HEIGHT)
-        fgColumnBuffer[columnBufferIdx] = baseTile + *mapDataAddr;
-        columnBufferIdx++;
-        mapDataAddr += fgMapTileWidth;
+        redrawScreen(backLayer);
     }
 
-    // Queue copying the buffer into VRAM.
-    DMA_queueDma(DMA_VRAM, (void*) fgColumnBuffer, PLANE_FG + ((columnToUpdate & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1), VDP_PLANE_TILE_HEIGHT, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+    u16 planeAddr = layer->planeAddr;
+    *layer = *backLayer;
+    backLayer->planeAddr = planeAddr;
 }
+#endif
 
-void redrawBackgroundColumn(u16 columnToUpdate)
+// Draw whatever part of the screen isn't resident in the plane yet, however far the camera moved.  Returns whether
+// anything was drawn.
+bool updateLayer(MapLayer* layer, u16 oldCameraTileX, u16 oldCameraTileY, u16 dmaPriority)
 {
-    // Calculate where in the tilemap the new row's tiles are located.
-    const u16* mapDataAddr = bgMapTilemap + bgRowOffsets[bgCameraTileY] + columnToUpdate;
+    if (layer->cameraTileX != oldCameraTileX)
+    {
+        layer->directionX = (layer->cameraTileX > oldCameraTileX) ? 1 : -1;
+    }
 
-    u16 columnBufferIdx = bgCameraTileY;
-    u16 baseTile = TILE_ATTR_FULL(PAL0, 0, 0, 0, bgTilesetStartIdx);
+    if (layer->cameraTileY != oldCameraTileY)
+    {
+        layer->directionY = (layer->cameraTileY > oldCameraTileY) ? 1 : -1;
+    }
 
-    // Copy the tiles into the buffer.
-    u16 i;
-    for (i = VDP_PLANE_TILE_HEIGHT; i != 0; i--)
+    u16 visibleColumnEnd = getVisibleColumnEnd(layer);
+
+    u16 visibleRowEnd = layer->cameraTileY + SCREEN_TILE_HEIGHT_PLUS_ONE;
+    if (visibleRowEnd > layer->extentTileHeight)
+    {
+        visibleRowEnd = layer->extentTileHeight;
+    }
+
+    if (layer->cameraTileX >= layer->residentColumnStart && visibleColumnEnd <= layer->residentColumnEnd
+        && layer->cameraTileY >= layer->residentRowStart && visibleRowEnd <= layer->residentRowEnd)
+    {
+        // Nothing new on screen.
+        return FALSE;
+    }
+
+    // Seams are drawn outwards from what's already resident, so that has to overlap the screen.  Past a few seams it's
+    // simpler to redraw the whole screen.
+    u16 missingColumns = seamLimit + 1;
+    u16 missingRows = seamLimit + 1;
+
+    if (layer->residentColumnStart < visibleColumnEnd && layer->residentColumnEnd > layer->cameraTileX
+        && layer->residentRowStart < visibleRowEnd && layer->residentRowEnd > layer->cameraTileY)
+    {
+        missingColumns = 0;
+        if (layer->residentColumnStart > layer->cameraTileX)
+        {
+            missingColumns += layer->residentColumnStart - layer->cameraTileX;
+        }
+
+        if (layer->residentColumnEnd < visibleColumnEnd)
+        {
+            missingColumns += visibleColumnEnd - layer->residentColumnEnd;
+        }
+
+        missingRows = 0;
+        if (layer->residentRowStart > layer->cameraTileY)
+        {
+            missingRows += layer->residentRowStart - layer->cameraTileY;
+        }
+
+        if (layer->residentRowEnd < visibleRowEnd)
+        {
+            missingRows += visibleRowEnd - layer->residentRowEnd;
+        }
+    }
+
+    if (missingColumns > seamLimit || missingRows > seamLimit)
+    {
+#if (SCROLLINGMAP_INCREMENTAL_REDRAW != 0)
+        // A redraw that's under way carries on however many columns it has left, as long as what it's drawn so far is
+        // still on screen.
+        if (!layer->redrawing || missingRows > seamLimit)
+        {
+            startRedraw(layer, visibleColumnEnd);
+        }
+#else
+        redrawScreen(layer);
+        return TRUE;
+#endif
+    }
+
+    // Rows first.  Each row spans the whole screen, so the columns still missing afterwards are the same ones that
+    // were missing before.  If the DMA budget runs out, whatever is left gets drawn next frame.
+    u16 first;
+    u16 tileCount;
+
+    getRowSpan(layer, &first, &tileCount);
+    while (layer->residentRowStart > layer->cameraTileY)
     {
-        columnBufferIdx &= 0x1F;  // columnBufferIdx MOD 32 (VDP_PLANE_TILE_HEIGHT)
-        bgColumnBuffer[columnBufferIdx] = baseTile + *mapDataAddr;
-        columnBufferIdx++;
-        mapDataAddr += bgMapTileWidth;
+        // Moved up.
+        if (!redrawRow(layer, layer->residentRowStart - 1, first, tileCount, dmaPriority))
+        {
+            return TRUE;
+        }
+    }
+
+    while (layer->residentRowEnd < visibleRowEnd)
+    {
+        // Moved down.
+        if (!redrawRow(layer, layer->residentRowEnd, first, tileCount, dmaPriority))
+        {
+            return TRUE;
+        }
+    }
+
+    // A redraw's columns come after the foreground's seams and within the DMA budget, a few at a time.
+    u16 columnPriority = dmaPriority;
+    u16 columnsLeft = LAYER_UNBOUNDED;
+#if (SCROLLINGMAP_INCREMENTAL_REDRAW != 0)
+    if (layer->redrawing)
+    {
+        columnPriority = DMA_PRIORITY_REDRAW;
+        columnsLeft = SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME;
+    }
+#endif
+
+    // Right and left in turn, so a redraw grows outwards from the middle of the screen.
+    getColumnSpan(layer, &first, &tileCount);
+    bool drewColumn = TRUE;
+    while (drewColumn)
+    {
+        drewColumn = FALSE;
+
+        if (layer->residentColumnEnd < visibleColumnEnd)
+        {
+            // Moved right.
+            if (columnsLeft == 0 || !redrawColumn(layer, layer->residentColumnEnd, first, tileCount, columnPriority))
+            {
+                return TRUE;
+            }
+
+            columnsLeft--;
+            drewColumn = TRUE;
+        }
+
+        if (layer->residentColumnStart > layer->cameraTileX)
+        {
+            // Moved left.
+            if (columnsLeft == 0 || !redrawColumn(layer, layer->residentColumnStart - 1, first, tileCount, columnPriority))
+            {
+                return TRUE;
+            }
+
+            columnsLeft--;
+            drewColumn = TRUE;
+        }
     }
 
-    // Queue copying the buffer into VRAM.
-    DMA_queueDma(DMA_VRAM, (void*) bgColumnBuffer, PLANE_BG + ((columnToUpdate & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1), VDP_PLANE_TILE_HEIGHT, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+    layer->redrawing = FALSE;
+    return TRUE;
 }
 
-// Redraw the whole screen.  Normally this would be done with the screen blacked out.
-void redrawForegroundScreen()
+// Spend a quiet frame drawing the next column (or, failing that, row) beyond the edge of the screen in the direction
+// the camera last moved, so it's already resident by the time it scrolls into view.  Only uses DMA budget nothing else
+// wants.
+void prefetchLayer(MapLayer* layer)
 {
-    u16 currentCol = SCREEN_TILE_WIDTH_PLUS_ONE;
-    do
+    // Prefetching grows the resident area outwards, so it has to cover the screen to begin with.
+    if (!isColumnResident(layer, layer->cameraTileX) || !isRowResident(layer, layer->cameraTileY))
     {
-        currentCol--;
+        return;
+    }
+
+    // Prefetched rows and columns cover the whole resident area so that they don't shrink it, or the whole plane for a
+    // map that repeats across it.
+
+#if (SCROLLINGMAP_PREFETCH_COLUMNS != 0)
+    // Never prefetch so far that a visible column would be pushed out of the plane.
+    u16 visibleColumnEnd = layer->cameraTileX + layer->viewTileWidth;
+    if (layer->directionX > 0)
+    {
+        u16 column = layer->residentColumnEnd;
+        if (column < layer->extentTileWidth && column < visibleColumnEnd + SCROLLINGMAP_PREFETCH_COLUMNS
+            && column < layer->cameraTileX + VDP_PLANE_TILE_WIDTH)
+        {
+            u16 firstRow;
+            u16 tileCount;
+            getPrefetchColumnSpan(layer, &firstRow, &tileCount);
+            redrawColumn(layer, column, firstRow, tileCount, DMA_PRIORITY_PREFETCH);
+            return;
+        }
+    }
+    else
+    {
+        u16 column = layer->residentColumnStart - 1;
+        if (layer->residentColumnStart != 0 && column + SCROLLINGMAP_PREFETCH_COLUMNS >= layer->cameraTileX
+            && column + VDP_PLANE_TILE_WIDTH >= visibleColumnEnd)
+        {
+            u16 firstRow;
+            u16 tileCount;
+            getPrefetchColumnSpan(layer, &firstRow, &tileCount);
+            redrawColumn(layer, column, firstRow, tileCount, DMA_PRIORITY_PREFETCH);
+            return;
+        }
+    }
+#endif
 
-        // Calculate where in the tilemap the new row's tiles are located.
-        const u16* mapDataAddr = fgMapTilemap + fgRowOffsets[fgCameraTileY] + fgCameraTileX + currentCol;
+#if (SCROLLINGMAP_PREFETCH_ROWS != 0)
+    if (layer->directionY > 0)
+    {
+        u16 row = layer->residentRowEnd;
+        if (row < layer->extentTileHeight && row < layer->cameraTileY + SCREEN_TILE_HEIGHT_PLUS_ONE + SCROLLINGMAP_PREFETCH_ROWS)
+        {
+            u16 firstColumn;
+            u16 tileCount;
+            getPrefetchRowSpan(layer, &firstColumn, &tileCount);
+            redrawRow(layer, row, firstColumn, tileCount, DMA_PRIORITY_PREFETCH);
+        }
+    }
+    else
+    {
+        u16 row = layer->residentRowStart - 1;
+        if (layer->residentRowStart != 0 && row + SCROLLINGMAP_PREFETCH_ROWS >= layer->cameraTileY)
+        {
+            u16 firstColumn;
+            u16 tileCount;
+            getPrefetchRowSpan(layer, &firstColumn, &tileCount);
+            redrawRow(layer, row, firstColumn, tileCount, DMA_PRIORITY_PREFETCH);
+        }
+    }
+#endif
+}
 
-        u16 columnBufferIdx = fgCameraTileY;
-        u16 baseTile = TILE_ATTR_FULL(PAL1, 0, 0, 0, fgTilesetStartIdx);
+void ScrollingMap_updateVDP()
+{
+    // Line scrolling is DMA'd by updateLineScroll instead.
+#if (SCROLLINGMAP_LINE_SCROLL == 0)
+    VDP_setHorizontalScroll(BG_A, -fgLayer.cameraPixelX);
+    VDP_setHorizontalScroll(BG_B, -bgLayer.cameraPixelX);
+#endif
+    VDP_setVerticalScroll(BG_A, fgLayer.cameraPixelY);
+    VDP_setVerticalScroll(BG_B, bgLayer.cameraPixelY);
 
-        // Copy the tiles into the buffer.
-        u16 i;
-        for (i = VDP_PLANE_TILE_HEIGHT; i != 0; i--)
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+    // In the same vblank as the scroll values for the new camera position.
+    if (planesFlipped)
+    {
+        VDP_setBGAAddress(fgLayer.planeAddr);
+        if (SCROLLINGMAP_BG_BACK_PLANE_ADDR != 0)
         {
-            columnBufferIdx &= 0x1F;  // columnBufferIdx MOD 32 (VDP_PLANE_TILE_HEIGHT)
-            fgColumnBuffer[columnBufferIdx] = baseTile + *mapDataAddr;
-            columnBufferIdx++;
-            mapDataAddr += fgMapTileWidth;
+            VDP_setBGBAddress(bgLayer.planeAddr);
         }
 
-        // Since we're redrawing the whole screen, do the DMA immediately instead of queuing it up.
-        DMA_doDma(DMA_VRAM, (void*) fgColumnBuffer, PLANE_FG + (((fgCameraTileX + currentCol) & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1), VDP_PLANE_TILE_HEIGHT, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        planesFlipped = FALSE;
     }
-    while (currentCol != 0);
+#endif
 }
 
-void redrawBackgroundScreen()
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+// Queue DMAs for whichever parts of the H-scroll table changed.  They're sent at the same vblank as the seams for the
+// new camera position.
+void updateLineScroll()
 {
-    u16 currentCol = SCREEN_TILE_WIDTH_PLUS_ONE;
-    do
+    queueLineScroll(fgLineScroll, 0, 0, SCREEN_PIXEL_HEIGHT, -fgLayer.cameraPixelX);
+
+    u16 i;
+    for (i = 0; i < bgBandCount; i++)
     {
-        currentCol--;
+        u16 endLine = (i + 1 < bgBandCount) ? bgBands[i + 1].startLine : SCREEN_PIXEL_HEIGHT;
+        queueLineScroll(bgLineScroll, 2, bgBands[i].startLine, endLine, -bgBandPixelX[i]);
+    }
+
+    lineScrollDirty = FALSE;
+}
 
-        // Calculate where in the tilemap the new row's tiles are located.
-        const u16* mapDataAddr = bgMapTilemap + bgRowOffsets[bgCameraTileY] + bgCameraTileX + currentCol;
+// Set lines [startLine, endLine) of one plane's H-scroll entries, queuing a DMA if they changed.  planeOffset is 0 for
+// plane A and 2 for plane B, which are interleaved in the table.
+void queueLineScroll(s16* lineScroll, u16 planeOffset, u16 startLine, u16 endLine, s16 value)
+{
+    if (startLine >= endLine || (!lineScrollDirty && lineScroll[startLine] == value))
+    {
+        return;
+    }
 
-        u16 columnBufferIdx = bgCameraTileY;
-        u16 baseTile = TILE_ATTR_FULL(PAL0, 0, 0, 0, bgTilesetStartIdx);
+    u16 lineCount = endLine - startLine;
+    s16* line = lineScroll + startLine;
 
-        // Copy the tiles into the buffer.
-        u16 i;
-        for (i = VDP_PLANE_TILE_HEIGHT; i != 0; i--)
+    u16 i;
+    for (i = lineCount; i != 0; i--)
+    {
+        *line = value;
+        line++;
+    }
+
+    // Each line's entry is 4 bytes: plane A then plane B.
+    DMAScheduler_reserve(DMA_PRIORITY_SCROLL, lineCount << 1);
+    DMA_queueDma(DMA_VRAM, lineScroll + startLine, VDP_HSCROLL_TABLE + (startLine << 2) + planeOffset, lineCount, 4);
+}
+#endif
+
+// Draw tiles [firstColumn, firstColumn + tileCount) of a map row.  Returns FALSE if the row didn't fit in this frame's
+// DMA budget.
+bool redrawRow(MapLayer* layer, u16 rowToUpdate, u16 firstColumn, u16 tileCount, u16 dmaPriority)
+{
+    u16 planeRowAddr = layer->planeAddr + ((((rowToUpdate & VDP_PLANE_TILE_HEIGHT_MINUS_ONE) << 6)) << 1);
+
+#if (SCROLLINGMAP_ROWS_FROM_ROM != 0)
+    if (!DMAScheduler_reserve(dmaPriority, tileCount << 1))
+    {
+        return FALSE;
+    }
+
+    // The map already holds name-table words, so DMA straight from ROM, a piece at a time if the row wraps around the
+    // end of the map.
+    const u16* mapRowAddr = layer->rows[wrapRow(layer, rowToUpdate)];
+    u16 column = firstColumn;
+    u16 mapColumn = wrapColumn(layer, firstColumn);
+    u16 remaining = tileCount;
+    while (remaining != 0)
+    {
+        u16 count = layer->mapTileWidth - mapColumn;
+        if (count > remaining)
         {
-            columnBufferIdx &= 0x1F;  // columnBufferIdx MOD 32 (VDP_PLANE_TILE_HEIGHT)
-            bgColumnBuffer[columnBufferIdx] = baseTile + *mapDataAddr;
-            columnBufferIdx++;
-            mapDataAddr += bgMapTileWidth;
+            count = remaining;
         }
 
-        // Since we're redrawing the whole screen, do the DMA immediately instead of queuing it up.
-        DMA_doDma(DMA_VRAM, (void*) bgColumnBuffer, PLANE_BG + (((bgCameraTileX + currentCol) & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1), VDP_PLANE_TILE_HEIGHT, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        queueRowDma(planeRowAddr, mapRowAddr + mapColumn, column, count);
+        column += count;
+        remaining -= count;
+        mapColumn = 0;
     }
-    while (currentCol != 0);
+#else
+    // Rows are built in staging RAM since they can't be DMA'd straight from the map.
+    u16* rowBuffer = DMAScheduler_allocStaging(tileCount << 1);
+    if (rowBuffer == NULL)
+    {
+        return FALSE;
+    }
+
+    if (!DMAScheduler_reserve(dmaPriority, tileCount << 1))
+    {
+        // Give the staging RAM back so it's there for whatever does fit this frame.
+        DMAScheduler_freeStaging(rowBuffer);
+        return FALSE;
+    }
+
+    fetchRow(layer, rowToUpdate, firstColumn, tileCount, rowBuffer);
+    queueRowDma(planeRowAddr, rowBuffer, firstColumn, tileCount);
+#endif
+
+    markRowResident(layer, rowToUpdate, firstColumn, tileCount);
+    seamsDrawn++;
+    return TRUE;
 }
 
-void updateCamera()
+// Draw tiles [firstRow, firstRow + tileCount) of a map column.  Returns FALSE if the column didn't fit in this frame's
+// DMA budget.
+bool redrawColumn(MapLayer* layer, u16 columnToUpdate, u16 firstRow, u16 tileCount, u16 dmaPriority)
 {
-    // TODO -- Calculate the camera's position based on the player's current position.
-
-    // TODO -- Make sure the camera's position doesn't go below zero (for this demo we do this in JoypadHandler).
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+    if (!DMAScheduler_reserve(dmaPriority, tileCount << 1))
+    {
+        return FALSE;
+    }
 
-    if (fgCameraPixelX > fgCameraLimitPixelX)
+    dmaMapColumn(layer, columnToUpdate, firstRow, tileCount, FALSE);
+#else
+    // Columns are gathered into staging RAM since they aren't contiguous in the map.
+    u16* columnBuffer = DMAScheduler_allocStaging(tileCount << 1);
+    if (columnBuffer == NULL)
     {
-        fgCameraPixelX = fgCameraLimitPixelX;
+        return FALSE;
     }
 
-    if (fgCameraPixelY > fgCameraLimitPixelY)
+    if (!DMAScheduler_reserve(dmaPriority, tileCount << 1))
     {
-        fgCameraPixelY = fgCameraLimitPixelY;
+        // Give the staging RAM back so it's there for whatever does fit this frame.
+        DMAScheduler_freeStaging(columnBuffer);
+        return FALSE;
     }
 
-    fgCameraTileX = PIXEL_TO_TILE(fgCameraPixelX);
-    fgCameraTileY = PIXEL_TO_TILE(fgCameraPixelY);
+    u16 planeColumnAddr = layer->planeAddr + ((columnToUpdate & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1);
+    fetchColumn(layer, columnToUpdate, firstRow, tileCount, columnBuffer);
+    dmaColumn(planeColumnAddr, columnBuffer, firstRow, tileCount, FALSE);
+#endif
+
+    markColumnResident(layer, columnToUpdate, firstRow, tileCount);
+    seamsDrawn++;
+    return TRUE;
+}
+
+// Redraw the whole screen.  Normally this would be done with the screen blacked out.
+void redrawScreen(MapLayer* layer)
+{
+    // Whatever the plane held before is being replaced.
+    layer->redrawing = FALSE;
+    layer->residentColumnStart = layer->cameraTileX;
+    layer->residentColumnEnd = layer->cameraTileX;
+    layer->residentRowStart = layer->cameraTileY;
+    layer->residentRowEnd = layer->cameraTileY;
+
+    u16 firstRow;
+    u16 tileCount;
+    getColumnSpan(layer, &firstRow, &tileCount);
+
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS == 0)
+    // The DMA happens straight away, so the buffer can live on the stack and be reused for every column.
+    u16 columnBuffer[VDP_PLANE_TILE_HEIGHT];
+#endif
+
+    // A map that repeats across the plane gets the whole plane filled, after which it never needs another column.
+    u16 currentCol = layer->periodicX ? VDP_PLANE_TILE_WIDTH : layer->viewTileWidth;
+    do
+    {
+        currentCol--;
+
+        u16 column = layer->cameraTileX + currentCol;
+        if (column >= layer->extentTileWidth)
+        {
+            continue;
+        }
+
+        // Since we're redrawing the whole screen, do the DMA immediately instead of queuing it up.
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+        dmaMapColumn(layer, column, firstRow, tileCount, TRUE);
+#else
+        u16 planeColumnAddr = layer->planeAddr + ((column & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1);
+        fetchColumn(layer, column, firstRow, tileCount, columnBuffer);
+        dmaColumn(planeColumnAddr, columnBuffer, firstRow, tileCount, TRUE);
+#endif
+
+        markColumnResident(layer, column, firstRow, tileCount);
+        seamsDrawn++;
+    }
+    while (currentCol != 0);
+}
+
+// Fill the whole plane around the camera, for when nothing is on screen yet.  The name table is built a band of rows at
+// a time in staging RAM and sent with one DMA per band (two with the default 2KB of staging), rather than a DMA per
+// column.  Falls back to redrawScreen if the staging RAM is in use.
+void loadScreen(MapLayer* layer)
+{
+    u16* buffer = DMAScheduler_allocStaging(LOAD_ROWS_PER_DMA * VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+    if (buffer == NULL)
+    {
+        redrawScreen(layer);
+        return;
+    }
+
+    // As much of the map as the plane holds, from a little behind the camera on each axis (since most of the game
+    // scrolls right and down), and not past the map edges.
+    u16 columnStart = (layer->cameraTileX > SCROLLINGMAP_SEAM_MARGIN_COLUMNS) ? layer->cameraTileX - SCROLLINGMAP_SEAM_MARGIN_COLUMNS : 0;
+    u16 columnEnd = columnStart + VDP_PLANE_TILE_WIDTH;
+    if (columnEnd > layer->extentTileWidth)
+    {
+        columnEnd = layer->extentTileWidth;
+        columnStart = (columnEnd > VDP_PLANE_TILE_WIDTH) ? columnEnd - VDP_PLANE_TILE_WIDTH : 0;
+    }
+
+    u16 rowStart = (layer->cameraTileY > SCROLLINGMAP_SEAM_MARGIN_ROWS) ? layer->cameraTileY - SCROLLINGMAP_SEAM_MARGIN_ROWS : 0;
+    u16 rowEnd = rowStart + VDP_PLANE_TILE_HEIGHT;
+    if (rowEnd > layer->extentTileHeight)
+    {
+        rowEnd = layer->extentTileHeight;
+        rowStart = (rowEnd > VDP_PLANE_TILE_HEIGHT) ? rowEnd - VDP_PLANE_TILE_HEIGHT : 0;
+    }
+
+    // Map columns wrap around the plane, so each row goes in as two pieces: from columnStart to the right edge of the
+    // plane, then on from its left edge.
+    u16 columnCount = columnEnd - columnStart;
+    u16 planeColumn = columnStart & VDP_PLANE_TILE_WIDTH_MINUS_ONE;
+    u16 firstPieceCount = VDP_PLANE_TILE_WIDTH - planeColumn;
+    if (firstPieceCount > columnCount)
+    {
+        firstPieceCount = columnCount;
+    }
+
+    u16 firstPlaneRow;
+    for (firstPlaneRow = 0; firstPlaneRow < VDP_PLANE_TILE_HEIGHT; firstPlaneRow += LOAD_ROWS_PER_DMA)
+    {
+        // Anything off the edge of the map is left blank.
+        memset(buffer, 0, LOAD_ROWS_PER_DMA * VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+
+        u16 i;
+        for (i = 0; i < LOAD_ROWS_PER_DMA; i++)
+        {
+            u16 row = rowStart + ((firstPlaneRow + i - rowStart) & VDP_PLANE_TILE_HEIGHT_MINUS_ONE);
+            if (row >= rowEnd)
+            {
+                continue;
+            }
+
+            u16* planeRow = buffer + (i << 6);  // i * VDP_PLANE_TILE_WIDTH
+            fetchRow(layer, row, columnStart, firstPieceCount, planeRow + planeColumn);
+            if (columnCount != firstPieceCount)
+            {
+                fetchRow(layer, row, columnStart + firstPieceCount, columnCount - firstPieceCount, planeRow);
+            }
+        }
+
+        DMA_doDma(DMA_VRAM, buffer, layer->planeAddr + (firstPlaneRow << 7), LOAD_ROWS_PER_DMA << 6, 2);
+    }
+
+    DMAScheduler_freeStaging(buffer);
+
+    layer->redrawing = FALSE;
+    layer->residentColumnStart = columnStart;
+    layer->residentColumnEnd = columnEnd;
+    layer->residentRowStart = rowStart;
+    layer->residentRowEnd = rowEnd;
+    normalizeResident(layer);
+}
+
+// Forget what the plane held and start a redraw from the middle column of the screen, which updateLayer then draws
+// outwards from over the next few frames.
+void startRedraw(MapLayer* layer, u16 visibleColumnEnd)
+{
+    u16 middle = layer->cameraTileX + ((visibleColumnEnd - layer->cameraTileX) >> 1);
+    layer->residentColumnStart = middle;
+    layer->residentColumnEnd = middle;
+
+    // Rows are resident as far as the redraw's columns will reach, so no rows are drawn meanwhile.
+    u16 firstRow;
+    u16 tileCount;
+    layer->residentRowStart = layer->cameraTileY;
+    layer->residentRowEnd = layer->cameraTileY;
+    getColumnSpan(layer, &firstRow, &tileCount);
+    layer->residentRowStart = firstRow;
+    layer->residentRowEnd = firstRow + tileCount;
+
+    layer->redrawing = TRUE;
+}
+
+#if (SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS != 0)
+// DMA tiles [firstRow, firstRow + tileCount) of a map column straight from the column-major copy of the map, a piece
+// at a time if the column wraps around the bottom of the map.  The DMA is queued unless immediate is set.
+void dmaMapColumn(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount, bool immediate)
+{
+    u16 planeColumnAddr = layer->planeAddr + ((column & VDP_PLANE_TILE_WIDTH_MINUS_ONE) << 1);
+    const u16* mapColumnAddr = layer->columns + (wrapColumn(layer, column) * layer->mapTileHeight);
+    u16 row = firstRow;
+    u16 mapRow = wrapRow(layer, firstRow);
+
+    while (tileCount != 0)
+    {
+        u16 count = layer->mapTileHeight - mapRow;
+        if (count > tileCount)
+        {
+            count = tileCount;
+        }
+
+        dmaColumn(planeColumnAddr, mapColumnAddr + mapRow, row, count, immediate);
+        row += count;
+        tileCount -= count;
+        mapRow = 0;
+    }
+}
+#endif
+
+#if (SCROLLINGMAP_CHUNKED_MAPS != 0)
+// Copy tiles [firstColumn, firstColumn + tileCount) of a map row into buffer as name-table words.
+void fetchRow(MapLayer* layer, u16 row, u16 firstColumn, u16 tileCount, u16* buffer)
+{
+    u16 mapRow = wrapRow(layer, row);
+    u16 column = wrapColumn(layer, firstColumn);
+    while (tileCount != 0)
+    {
+        // Copy up to the end of the chunk or the map, whichever comes first.
+        u16 offset = column & (SCROLLINGMAP_CHUNK_TILES - 1);
+        u16 count = SCROLLINGMAP_CHUNK_TILES - offset;
+        if (count > tileCount)
+        {
+            count = tileCount;
+        }
+
+        if (count > layer->mapTileWidth - column)
+        {
+            count = layer->mapTileWidth - column;
+        }
+
+        const u16* tiles = getChunkRow(layer, column >> 4, mapRow) + offset;
+        tileCount -= count;
+        column += count;
+        if (column == layer->mapTileWidth)
+        {
+            column = 0;
+        }
+
+        for (; count != 0; count--)
+        {
+            *buffer = *tiles;
+            buffer++;
+            tiles++;
+        }
+    }
+}
+
+// Copy tiles [firstRow, firstRow + tileCount) of a map column into buffer as name-table words.
+void fetchColumn(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount, u16* buffer)
+{
+    u16 mapColumn = wrapColumn(layer, column);
+    u16 chunkColumn = mapColumn >> 4;
+    u16 offset = mapColumn & (SCROLLINGMAP_CHUNK_TILES - 1);
+    u16 row = wrapRow(layer, firstRow);
+
+    for (; tileCount != 0; tileCount--)
+    {
+        *buffer = getChunkRow(layer, chunkColumn, row)[offset];
+        buffer++;
+        row++;
+        if (row == layer->mapTileHeight)
+        {
+            row = 0;
+        }
+    }
+}
+
+// Returns the 16 name-table words of a map row that fall in the given column of chunks, decoding them if they aren't
+// already cached.  The cache is direct mapped: each map row (mod 32) of each chunk column (mod
+// SCROLLINGMAP_CHUNK_CACHE_COLUMNS) has its own slot, so a seam column never evicts its own rows.
+const u16* getChunkRow(MapLayer* layer, u16 chunkColumn, u16 row)
+{
+    ChunkRow* chunkRow = &layer->chunkRowCache[((chunkColumn & (SCROLLINGMAP_CHUNK_CACHE_COLUMNS - 1)) << 5) | (row & VDP_PLANE_TILE_HEIGHT_MINUS_ONE)];
+    if (chunkRow->chunkColumn == chunkColumn && chunkRow->row == row)
+    {
+        return chunkRow->tiles;
+    }
+
+    chunkRow->chunkColumn = chunkColumn;
+    chunkRow->row = row;
+
+    // Each chunk is 8x8 metatiles and each metatile is 2x2 tiles, both stored row by row.
+    u16 chunk = layer->layout[(row >> 4) * layer->layoutWidth + chunkColumn];
+    const u16* metatileIndex = layer->chunks + (chunk << 6) + ((row & 14) << 2);  // ((row / 2) % 8) * 8
+    const u16* metatiles = layer->metatiles + ((row & 1) << 1);                    // Top or bottom half
+    u16* tiles = chunkRow->tiles;
+
+    u16 i;
+    for (i = SCROLLINGMAP_CHUNK_TILES >> 1; i != 0; i--)
+    {
+        const u16* metatile = metatiles + (*metatileIndex << 2);
+        tiles[0] = metatile[0];
+        tiles[1] = metatile[1];
+        tiles += 2;
+        metatileIndex++;
+    }
+
+    return chunkRow->tiles;
+}
+#else
+// Copy tiles [firstColumn, firstColumn + tileCount) of a map row into buffer as name-table words.
+void fetchRow(MapLayer* layer, u16 row, u16 firstColumn, u16 tileCount, u16* buffer)
+{
+    const u16* mapRowAddr = layer->rows[wrapRow(layer, row)];
+    u16 column = wrapColumn(layer, firstColumn);
+    const u16* mapDataAddr = mapRowAddr + column;
+    u16 baseTile = layer->baseTile;
+
+    for (; tileCount != 0; tileCount--)
+    {
+        *buffer = baseTile + *mapDataAddr;
+        buffer++;
+        mapDataAddr++;
+
+        column++;
+        if (column == layer->mapTileWidth)
+        {
+            column = 0;
+            mapDataAddr = mapRowAddr;
+        }
+    }
+}
+
+// Copy tiles [firstRow, firstRow + tileCount) of a map column into buffer as name-table words.
+void fetchColumn(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount, u16* buffer)
+{
+    u16 mapColumn = wrapColumn(layer, column);
+    u16 row = wrapRow(layer, firstRow);
+    const u16* mapDataAddr = layer->rows[row] + mapColumn;
+    u16 baseTile = layer->baseTile;
+
+    for (; tileCount != 0; tileCount--)
+    {
+        *buffer = baseTile + *mapDataAddr;
+        buffer++;
+        mapDataAddr += layer->mapTileWidth;
+
+        row++;
+        if (row == layer->mapTileHeight)
+        {
+            row = 0;
+            mapDataAddr = layer->rows[0] + mapColumn;
+        }
+    }
+}
+#endif
+
+// The map column shown at a layer column, for maps that wrap.
+u16 wrapColumn(MapLayer* layer, u16 column)
+{
+    return (column < layer->mapTileWidth) ? column : (column % layer->mapTileWidth);
+}
+
+// The map row shown at a layer row, for maps that wrap.
+u16 wrapRow(MapLayer* layer, u16 row)
+{
+    return (row < layer->mapTileHeight) ? row : (row % layer->mapTileHeight);
+}
+
+// Whether the plane already holds every tile of the given map row that can be on screen.
+bool isRowResident(MapLayer* layer, u16 row)
+{
+    u16 visibleEnd = layer->cameraTileX + layer->viewTileWidth;
+    if (visibleEnd > layer->extentTileWidth)
+    {
+        visibleEnd = layer->extentTileWidth;
+    }
+
+    return row >= layer->residentRowStart && row < layer->residentRowEnd
+        && layer->cameraTileX >= layer->residentColumnStart && visibleEnd <= layer->residentColumnEnd;
+}
+
+// Whether the plane already holds every tile of the given map column that can be on screen.
+bool isColumnResident(MapLayer* layer, u16 column)
+{
+    u16 visibleEnd = layer->cameraTileY + SCREEN_TILE_HEIGHT_PLUS_ONE;
+    if (visibleEnd > layer->extentTileHeight)
+    {
+        visibleEnd = layer->extentTileHeight;
+    }
+
+    return column >= layer->residentColumnStart && column < layer->residentColumnEnd
+        && layer->cameraTileY >= layer->residentRowStart && visibleEnd <= layer->residentRowEnd;
+}
+
+// Record that a row was drawn over columns [firstColumn, firstColumn + tileCount).  The resident area only keeps what
+// is known to be up to date: columns the row didn't cover are dropped, and so is the row it replaced in the plane.
+void markRowResident(MapLayer* layer, u16 row, u16 firstColumn, u16 tileCount)
+{
+    u16 endColumn = firstColumn + tileCount;
+
+    if (layer->residentColumnStart < firstColumn)
+    {
+        layer->residentColumnStart = firstColumn;
+    }
+
+    if (layer->residentColumnEnd > endColumn)
+    {
+        layer->residentColumnEnd = endColumn;
+    }
+
+    if (layer->residentColumnStart >= layer->residentColumnEnd || row + 1 < layer->residentRowStart || row > layer->residentRowEnd)
+    {
+        // Nothing in common with what was already there.
+        layer->residentColumnStart = firstColumn;
+        layer->residentColumnEnd = endColumn;
+        layer->residentRowStart = row;
+        layer->residentRowEnd = row + 1;
+    }
+    else if (row == layer->residentRowEnd)
+    {
+        layer->residentRowEnd++;
+        if (layer->residentRowEnd - layer->residentRowStart > VDP_PLANE_TILE_HEIGHT)
+        {
+            layer->residentRowStart++;
+        }
+    }
+    else if (row + 1 == layer->residentRowStart)
+    {
+        layer->residentRowStart--;
+        if (layer->residentRowEnd - layer->residentRowStart > VDP_PLANE_TILE_HEIGHT)
+        {
+            layer->residentRowEnd--;
+        }
+    }
+
+    normalizeResident(layer);
+}
+
+// Record that a column was drawn over rows [firstRow, firstRow + tileCount).  See markRowResident.
+void markColumnResident(MapLayer* layer, u16 column, u16 firstRow, u16 tileCount)
+{
+    u16 endRow = firstRow + tileCount;
+
+    if (layer->residentRowStart < firstRow)
+    {
+        layer->residentRowStart = firstRow;
+    }
+
+    if (layer->residentRowEnd > endRow)
+    {
+        layer->residentRowEnd = endRow;
+    }
+
+    if (layer->residentRowStart >= layer->residentRowEnd || column + 1 < layer->residentColumnStart || column > layer->residentColumnEnd)
+    {
+        // Nothing in common with what was already there.
+        layer->residentColumnStart = column;
+        layer->residentColumnEnd = column + 1;
+        layer->residentRowStart = firstRow;
+        layer->residentRowEnd = endRow;
+    }
+    else if (column == layer->residentColumnEnd)
+    {
+        layer->residentColumnEnd++;
+        if (layer->residentColumnEnd - layer->residentColumnStart > VDP_PLANE_TILE_WIDTH)
+        {
+            layer->residentColumnStart++;
+        }
+    }
+    else if (column + 1 == layer->residentColumnStart)
+    {
+        layer->residentColumnStart--;
+        if (layer->residentColumnEnd - layer->residentColumnStart > VDP_PLANE_TILE_WIDTH)
+        {
+            layer->residentColumnEnd--;
+        }
+    }
+
+    normalizeResident(layer);
+}
+
+// A map that repeats across the plane looks the same wherever the camera is once the plane is full along that axis, so
+// from then on the resident area covers the whole axis.
+void normalizeResident(MapLayer* layer)
+{
+    if (layer->periodicX && layer->residentColumnEnd - layer->residentColumnStart >= VDP_PLANE_TILE_WIDTH)
+    {
+        layer->residentColumnStart = 0;
+        layer->residentColumnEnd = LAYER_UNBOUNDED;
+    }
+
+    if (layer->periodicY && layer->residentRowEnd - layer->residentRowStart >= VDP_PLANE_TILE_HEIGHT)
+    {
+        layer->residentRowStart = 0;
+        layer->residentRowEnd = LAYER_UNBOUNDED;
+    }
+}
+
+// The part of a map row drawn when the camera scrolls vertically: the columns that can be on screen plus
+// SCROLLINGMAP_SEAM_MARGIN_COLUMNS either side (if there's room), clamped to the map.  A map that repeats across the
+// plane gets the whole plane width.
+void getRowSpan(MapLayer* layer, u16* firstColumn, u16* tileCount)
+{
+    if (layer->periodicX)
+    {
+        *firstColumn = layer->cameraTileX;
+        *tileCount = VDP_PLANE_TILE_WIDTH;
+        return;
+    }
+
+    u16 start = 0;
+    if (layer->cameraTileX > SCROLLINGMAP_SEAM_MARGIN_COLUMNS)
+    {
+        start = layer->cameraTileX - SCROLLINGMAP_SEAM_MARGIN_COLUMNS;
+    }
+
+    u16 end = layer->cameraTileX + layer->viewTileWidth + SCROLLINGMAP_SEAM_MARGIN_COLUMNS;
+
+    // Parallax bands can leave no room in the plane for the margin.
+    if (end - start > VDP_PLANE_TILE_WIDTH)
+    {
+        start = layer->cameraTileX;
+        end = layer->cameraTileX + layer->viewTileWidth;
+    }
+
+    if (end > layer->extentTileWidth)
+    {
+        end = layer->extentTileWidth;
+    }
+
+    *firstColumn = start;
+    *tileCount = end - start;
+}
+
+// The part of a map column drawn when the camera scrolls horizontally: the rows that can be on screen plus
+// SCROLLINGMAP_SEAM_MARGIN_ROWS either side, clamped to the map.  Any other rows already resident are included too,
+// since a column is at most 32 tiles anyway and this keeps prefetched rows from being thrown away.  A map that repeats
+// down the plane gets the whole plane height.
+void getColumnSpan(MapLayer* layer, u16* firstRow, u16* tileCount)
+{
+    if (layer->periodicY)
+    {
+        *firstRow = layer->cameraTileY;
+        *tileCount = VDP_PLANE_TILE_HEIGHT;
+        return;
+    }
+
+    u16 start = 0;
+    if (layer->cameraTileY > SCROLLINGMAP_SEAM_MARGIN_ROWS)
+    {
+        start = layer->cameraTileY - SCROLLINGMAP_SEAM_MARGIN_ROWS;
+    }
+
+    u16 end = layer->cameraTileY + SCREEN_TILE_HEIGHT_PLUS_ONE + SCROLLINGMAP_SEAM_MARGIN_ROWS;
+    if (end > layer->extentTileHeight)
+    {
+        end = layer->extentTileHeight;
+    }
+
+    u16 visibleEnd = layer->cameraTileY + SCREEN_TILE_HEIGHT_PLUS_ONE;
+    if (visibleEnd > layer->extentTileHeight)
+    {
+        visibleEnd = layer->extentTileHeight;
+    }
+
+    if (layer->residentRowStart <= layer->cameraTileY && layer->residentRowEnd >= visibleEnd)
+    {
+        if (layer->residentRowStart < start)
+        {
+            start = layer->residentRowStart;
+        }
+
+        if (layer->residentRowEnd > end)
+        {
+            end = layer->residentRowEnd;
+        }
+
+        // Resident rows take precedence over the margin if there isn't room in the plane for both.
+        if (end - start > VDP_PLANE_TILE_HEIGHT)
+        {
+            if (end > layer->residentRowEnd)
+            {
+                end = start + VDP_PLANE_TILE_HEIGHT;
+            }
+            else
+            {
+                start = end - VDP_PLANE_TILE_HEIGHT;
+            }
+        }
+    }
+
+    *firstRow = start;
+    *tileCount = end - start;
+}
+
+// The end of the columns that can be on screen, or the edge of the map if that comes first.
+u16 getVisibleColumnEnd(MapLayer* layer)
+{
+    u16 visibleColumnEnd = layer->cameraTileX + layer->viewTileWidth;
+    if (visibleColumnEnd > layer->extentTileWidth)
+    {
+        visibleColumnEnd = layer->extentTileWidth;
+    }
+
+    return visibleColumnEnd;
+}
+
+// The part of a map row drawn when prefetching: the resident columns, or the whole plane width if they've been
+// normalized to cover the whole axis.
+void getPrefetchRowSpan(MapLayer* layer, u16* firstColumn, u16* tileCount)
+{
+    if (layer->periodicX)
+    {
+        getRowSpan(layer, firstColumn, tileCount);
+        return;
+    }
+
+    *firstColumn = layer->residentColumnStart;
+    *tileCount = layer->residentColumnEnd - layer->residentColumnStart;
+}
+
+// The part of a map column drawn when prefetching.  See getPrefetchRowSpan.
+void getPrefetchColumnSpan(MapLayer* layer, u16* firstRow, u16* tileCount)
+{
+    if (layer->periodicY)
+    {
+        getColumnSpan(layer, firstRow, tileCount);
+        return;
+    }
+
+    *firstRow = layer->residentRowStart;
+    *tileCount = layer->residentRowEnd - layer->residentRowStart;
+}
+
+// Queue a run of name-table words for a plane row, splitting the transfer where it wraps around the right edge of
+// the plane.
+void queueRowDma(u16 planeRowAddr, const u16* mapDataAddr, u16 firstColumn, u16 tileCount)
+{
+    u16 planeColumn = firstColumn & VDP_PLANE_TILE_WIDTH_MINUS_ONE;
+    u16 tilesBeforeWrap = VDP_PLANE_TILE_WIDTH - planeColumn;
+
+    if (tileCount <= tilesBeforeWrap)
+    {
+        DMA_queueDma(DMA_VRAM, (void*) mapDataAddr, planeRowAddr + (planeColumn << 1), tileCount, 2);
+    }
+    else
+    {
+        DMA_queueDma(DMA_VRAM, (void*) mapDataAddr, planeRowAddr + (planeColumn << 1), tilesBeforeWrap, 2);
+        DMA_queueDma(DMA_VRAM, (void*) (mapDataAddr + tilesBeforeWrap), planeRowAddr, tileCount - tilesBeforeWrap, 2);
+    }
+}
+
+// DMA a run of name-table words into a plane column, splitting the transfer where it wraps around the bottom of the
+// plane.  The DMA is queued unless immediate is set.
+void dmaColumn(u16 planeColumnAddr, const u16* mapDataAddr, u16 firstRow, u16 tileCount, bool immediate)
+{
+    u16 planeRow = firstRow & VDP_PLANE_TILE_HEIGHT_MINUS_ONE;
+    u16 tilesBeforeWrap = VDP_PLANE_TILE_HEIGHT - planeRow;
+    u16 planeAddr = planeColumnAddr + (planeRow << 7);  // planeRow * VDP_PLANE_TILE_WIDTH_TIMES_TWO
+
+    if (tilesBeforeWrap > tileCount)
+    {
+        tilesBeforeWrap = tileCount;
+    }
+
+    if (immediate)
+    {
+        DMA_doDma(DMA_VRAM, (void*) mapDataAddr, planeAddr, tilesBeforeWrap, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        if (tileCount != tilesBeforeWrap)
+        {
+            DMA_doDma(DMA_VRAM, (void*) (mapDataAddr + tilesBeforeWrap), planeColumnAddr, tileCount - tilesBeforeWrap, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        }
+    }
+    else
+    {
+        DMA_queueDma(DMA_VRAM, (void*) mapDataAddr, planeAddr, tilesBeforeWrap, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        if (tileCount != tilesBeforeWrap)
+        {
+            DMA_queueDma(DMA_VRAM, (void*) (mapDataAddr + tilesBeforeWrap), planeColumnAddr, tileCount - tilesBeforeWrap, VDP_PLANE_TILE_WIDTH_TIMES_TWO);
+        }
+    }
+}
+
+// Clamp the foreground camera to the map and work out where each layer is.  The background stays put unless
+// updateBackground is set.
+void updateCamera(bool updateBackground)
+{
+    // TODO -- Calculate the camera's position based on the player's current position.
+
+    // TODO -- Make sure the camera's position doesn't go below zero (for this demo we do this in JoypadHandler).
+
+    if (fgCameraPixelX > fgCameraLimitPixelX)
+    {
+        fgCameraPixelX = fgCameraLimitPixelX;
+    }
+
+    if (fgCameraPixelY > fgCameraLimitPixelY)
+    {
+        fgCameraPixelY = fgCameraLimitPixelY;
+    }
+
+    updateLayerCamera(&fgLayer, fgCameraPixelX, fgCameraPixelY);
+    if (updateBackground)
+    {
+        updateLayerCamera(&bgLayer, fgCameraPixelX, fgCameraPixelY);
+        updateBandCamera(&bgLayer, fgCameraPixelX, bgBandPixelX);
+    }
+}
+
+// Where a layer's camera is when the foreground camera is at (cameraPixelX, cameraPixelY).
+void updateLayerCamera(MapLayer* layer, u32 cameraPixelX, u32 cameraPixelY)
+{
+    layer->cameraPixelX = scaleCameraPixel(cameraPixelX, layer->ratioX, layer->cameraLimitPixelX);
+    layer->cameraPixelY = scaleCameraPixel(cameraPixelY, layer->ratioY, layer->cameraLimitPixelY);
+    layer->cameraTileX = PIXEL_TO_TILE(layer->cameraPixelX);
+    layer->cameraTileY = PIXEL_TO_TILE(layer->cameraPixelY);
+}
+
+// The parallax bands override the background's horizontal rate.  The layer covers every band, from the one scrolled
+// least to the one scrolled most.  Each band's position goes in bandPixelX.
+void updateBandCamera(MapLayer* layer, u32 cameraPixelX, u32* bandPixelX)
+{
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    u16 bandCount = bgBandCount;
+#else
+    u16 bandCount = 1;
+#endif
+
+    u32 minPixelX = 0xFFFFFFFF;
+    u32 maxPixelX = 0;
+    u16 i;
+    for (i = 0; i < bandCount; i++)
+    {
+        u32 pixelX = scaleCameraPixel(cameraPixelX, bgBands[i].ratio, layer->cameraLimitPixelX);
+        bandPixelX[i] = pixelX;
+
+        if (pixelX < minPixelX)
+        {
+            minPixelX = pixelX;
+        }
+
+        if (pixelX > maxPixelX)
+        {
+            maxPixelX = pixelX;
+        }
+    }
+
+    layer->cameraPixelX = minPixelX;
+    layer->cameraTileX = PIXEL_TO_TILE(minPixelX);
+    layer->viewTileWidth = PIXEL_TO_TILE(maxPixelX) - layer->cameraTileX + SCREEN_TILE_WIDTH_PLUS_ONE;
+    if (layer->viewTileWidth > VDP_PLANE_TILE_WIDTH)
+    {
+        layer->viewTileWidth = VDP_PLANE_TILE_WIDTH;
+    }
+}
+
+// Where a layer's camera is when the foreground camera is at cameraPixel.  Stops at the edge of the layer's map in case
+// the map is too small for the ratio.
+u32 scaleCameraPixel(u32 cameraPixel, fix16 ratio, u32 limit)
+{
+    u32 pixel = (cameraPixel * ratio) >> FIX16_FRAC_BITS;
+    if (pixel > limit)
+    {
+        pixel = limit;
+    }
 
-    bgCameraTileX = PIXEL_TO_TILE(fgCameraPixelX >> 1);
-    bgCameraTileY = PIXEL_TO_TILE(fgCameraPixelY >> 1);
+    return pixel;
 }
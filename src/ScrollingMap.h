@@ -5,21 +5,160 @@
 
 #define MAP_TILE_START_IDX 1
 
+// When nonzero, maps are read from the MapBaker output (mapdata.c), which already holds the final VDP name-table
+// words (palette, priority and tileset offset applied).  Rows are then DMA'd straight from ROM with no RAM copy.
+// Regenerate mapdata.c with "python3 tools/MapBaker.py img/mapdata.txt" whenever the maps or tilesets change.
+#define SCROLLINGMAP_PREBAKED_TILEMAPS 1
+
+// When nonzero, columns are DMA'd straight from the column-major copies of the prebaked maps in mapdata.c instead of
+// being gathered into a RAM buffer.  Costs a second copy of each map in ROM.  Requires SCROLLINGMAP_PREBAKED_TILEMAPS.
+#define SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS 1
+
+// When nonzero, maps are read from the chunked copies in mapdata.c: 2x2 tile metatiles grouped into 16x16 tile
+// (128x128 pixel) chunks, with a layout table of chunk indices per map.  Far smaller in ROM than a flat map, at the
+// cost of decoding rows and columns into RAM before they're DMA'd.  Requires SCROLLINGMAP_PREBAKED_TILEMAPS (the
+// chunks are built from the prebaked maps) and can't be combined with SCROLLINGMAP_COLUMN_MAJOR_TILEMAPS.
+#define SCROLLINGMAP_CHUNKED_MAPS 0
+
+// When nonzero, the tilesets are loaded from the compressed copies in mapdata.c (see TileDecoder.h), which take under
+// half the ROM, instead of the uncompressed ones in graphics.c.
+#define SCROLLINGMAP_COMPRESSED_TILESETS 1
+
+// Size of the chunked map format, in tiles.  Must match tools/MapBaker.py.
+#define SCROLLINGMAP_METATILE_TILES 2
+#define SCROLLINGMAP_CHUNK_TILES 16
+
+// Decoded chunk rows (16 name-table words each) are cached per plane, 32 map rows for each of this many chunk
+// columns, so scrolling sideways through a chunk only decodes each of its rows once.  Must be a power of two.
+#define SCROLLINGMAP_CHUNK_CACHE_COLUMNS 2
+
+// On frames where a plane needs no seam, ScrollingMap_update draws one column (or row) beyond the edge of the screen
+// in the direction the camera last moved, up to this many tiles ahead.  The plane has 64 - 41 = 23 spare columns and
+// 32 - 29 = 3 spare rows; whatever isn't used for prefetching keeps the tiles behind the camera for when it turns back.
+// Set to 0 to disable.
+#define SCROLLINGMAP_PREFETCH_COLUMNS 16
+#define SCROLLINGMAP_PREFETCH_ROWS 2
+
+// The most columns (and rows) each plane will draw in one frame to catch up with the camera.  If the camera moves
+// further than this in a single frame, the whole screen is redrawn instead.
+#define SCROLLINGMAP_MAX_SEAMS_PER_FRAME 4
+
+// When nonzero, redrawing the screen (after the camera jumps, or at a door or camera cut) is spread over a few frames
+// instead of done all at once with the CPU waiting on the DMA: the middle column first, then outwards, at most
+// SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME columns a frame and only as much as fits in the DMA budget.  Until it's done,
+// the columns either side still show what the plane held before, so the screen doesn't have to be blacked out, but
+// cuts look better with the edges hidden or a quick fade.  When zero, the whole screen is drawn in one go.
+#define SCROLLINGMAP_INCREMENTAL_REDRAW 1
+
+// With 14, the 41 columns on screen are drawn over three frames.
+#define SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME 14
+
+// When nonzero, the planes can have a second (back) name table each, out of sight.  ScrollingMap_prepareCut builds the
+// view from another camera position in the back tables a few columns a frame while the screen carries on scrolling,
+// then ScrollingMap_cut flips the VDP's plane base registers over to them in one vblank, so a room transition or a
+// camera cut needs neither a blacked-out frame nor a half-drawn screen.
+#define SCROLLINGMAP_DOUBLE_BUFFER 1
+
+// Where the back name tables go.  A plane's name table has to start on an 8KB boundary and takes 4KB at 64x32 tiles.
+// The tilesets end below 0x8000, and with SGDK's default layout its font sits just below the window at 0xB000, from
+// 0xA400, so 0x8000 is the only free slot.  The background can have 0xA000 if nothing draws text (no HUD or
+// benchmark).  At 0, the background has no back table and is redrawn after a cut as if the camera had jumped.
+#define SCROLLINGMAP_FG_BACK_PLANE_ADDR 0x8000
+#define SCROLLINGMAP_BG_BACK_PLANE_ADDR 0
+
+// What ScrollingMap_update does when the main loop has missed a vblank since the last update (see
+// ScrollingMap_setLagPolicy).
+//   SCROLLINGMAP_LAG_POLICY_NONE: carry on as normal.
+//   SCROLLINGMAP_LAG_POLICY_SKIP_BACKGROUND: leave the background where it was for that update (no scrolling, seams or
+//     prefetching), so the foreground gets the time.  The background catches up on the next update that's on time.
+//   SCROLLINGMAP_LAG_POLICY_CATCH_UP: let each plane draw up to SCROLLINGMAP_MAX_SEAMS_PER_FRAME more seams per missed
+//     frame (at most SCROLLINGMAP_MAX_CATCH_UP_FRAMES frames' worth) before falling back to a full redraw, and send the
+//     background's seams with the foreground's even if they go over the DMA budget, so a camera that moved further
+//     while the game was lagging doesn't leave stale columns on screen.
+#define SCROLLINGMAP_LAG_POLICY_NONE 0
+#define SCROLLINGMAP_LAG_POLICY_SKIP_BACKGROUND 1
+#define SCROLLINGMAP_LAG_POLICY_CATCH_UP 2
+
+#define SCROLLINGMAP_MAX_CATCH_UP_FRAMES 3
+
+// Rows drawn to catch up with the camera only cover the 41 columns that can be on screen plus this many either side,
+// instead of the whole plane width.  Likewise columns only cover the 29 visible rows plus SCROLLINGMAP_SEAM_MARGIN_ROWS
+// either side (and any other rows already resident).  Prefetched rows and columns cover the whole resident area.
+#define SCROLLINGMAP_SEAM_MARGIN_COLUMNS 2
+#define SCROLLINGMAP_SEAM_MARGIN_ROWS 1
+
+// A fraction as a fix16, in a form the preprocessor can evaluate (SGDK's FIX16 uses floating point).
+#define SCROLLINGMAP_RATIO(numerator, denominator) (((numerator) << FIX16_FRAC_BITS) / (denominator))
+
+// How fast the background scrolls relative to the foreground.  The background map has to be big enough not to run out
+// before the foreground does, i.e. at least (foreground size - screen size) * ratio + screen size; the build fails if
+// it isn't.  With line scrolling, ScrollingMap_setParallaxBands can override the horizontal rate.
+#define SCROLLINGMAP_BG_RATIO_X SCROLLINGMAP_RATIO(1, 2)
+#define SCROLLINGMAP_BG_RATIO_Y SCROLLINGMAP_RATIO(1, 2)
+
+// When nonzero, the background map repeats endlessly along that axis instead of ending, so it can be smaller than the
+// size check above requires.  A map whose width divides 64 (or height divides 32) lines up with the plane, so once the
+// plane is full no more seams are needed along that axis.
+#define SCROLLINGMAP_BG_WRAP_X 0
+#define SCROLLINGMAP_BG_WRAP_Y 0
+
+// When nonzero, the screen uses line scrolling (HSCROLL_LINE) so the background can be split into horizontal bands that
+// each scroll at their own rate.  See ScrollingMap_setParallaxBands.  When zero, the whole background scrolls at the
+// first band's rate.
+#define SCROLLINGMAP_LINE_SCROLL 1
+
+#define SCROLLINGMAP_MAX_PARALLAX_BANDS 8
+
 #define VDP_PLANE_TILE_WIDTH 64
 #define VDP_PLANE_TILE_WIDTH_MINUS_ONE 63
 #define VDP_PLANE_TILE_WIDTH_TIMES_TWO 128
 #define VDP_PLANE_TILE_HEIGHT 32
 #define VDP_PLANE_TILE_HEIGHT_MINUS_ONE 31
 
+// Screen lines from startLine up to the next band's startLine scroll horizontally at ratio times the foreground's rate.
+typedef struct
+{
+    u16 startLine;
+    fix16 ratio;
+} ParallaxBand;
+
 void ScrollingMap_init();
 void ScrollingMap_update();
 void ScrollingMap_updateVDP();
 
-// TODO -- Set this equal to the maximum allowed map height (in tiles).
-// 128 tiles = 1024 pixels = 4.57 times the height of the screen.  Seems like a reasonable limit.
-#define ROW_OFFSET_COUNT 128
+// Split the background into bandCount horizontal bands, in order from the top of the screen (the first must start at
+// line 0).  The bands are copied.  The background defaults to a single band at SCROLLINGMAP_BG_RATIO_X.  Between them
+// the bands mustn't be more than 64 tiles wide, i.e. the fastest and slowest mustn't drift more than 184 pixels apart.
+// Bands that would run off the right of the background map stop at its edge.
+void ScrollingMap_setParallaxBands(const ParallaxBand* bands, u16 bandCount);
+
+// Rows and columns drawn by the last ScrollingMap_update, across both planes, including prefetched ones and every
+// column of a full screen redraw.
+u16 ScrollingMap_getSeamsDrawn();
+
+// Whether either plane is partway through a redraw, so the screen doesn't all match the map yet.
+bool ScrollingMap_isRedrawing();
+
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+// Start building the view from foreground camera position (cameraPixelX, cameraPixelY) in the back name tables.  It's
+// drawn from the middle column outwards, a few columns at a time on frames the plane on show needs no seams and in DMA
+// budget nothing else wants, while the camera carries on as normal.  Starting another replaces it.
+void ScrollingMap_prepareCut(u32 cameraPixelX, u32 cameraPixelY);
+
+// Whether the view ScrollingMap_prepareCut started is all drawn.
+bool ScrollingMap_isCutReady();
+
+// Move the camera to the prepared view and show it from the next vblank.  Call before ScrollingMap_update.  Whatever
+// isn't drawn yet is drawn now, straight into the back tables, which takes a while but can't be seen.  The tables that
+// were on show become the back tables.
+void ScrollingMap_cut();
+#endif
+
+// Defaults to SCROLLINGMAP_LAG_POLICY_NONE.
+void ScrollingMap_setLagPolicy(u16 policy);
 
-u16 fgRowOffsets[ROW_OFFSET_COUNT];
-u16 bgRowOffsets[ROW_OFFSET_COUNT];
+// Vblanks missed between the last ScrollingMap_update and the one before it, and in total since ScrollingMap_init.
+u16 ScrollingMap_getLagFrames();
+u32 ScrollingMap_getTotalLagFrames();
 
 #endif // SCROLLINGMAP_H
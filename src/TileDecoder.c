@@ -0,0 +1,81 @@
+#include <genesis.h>
+#include "DMAScheduler.h"
+#include "TileDecoder.h"
+
+#if (TILEDECODER_MAX_BLOCK_TILES * 32 > DMA_STAGING_SIZE)
+#error "A block of tiles has to fit in the DMA staging RAM"
+#endif
+
+#define TILE_WORDS 16
+
+void TileDecoder_decodeBlock(const u16* src, u16* dst, u16 wordCount)
+{
+    const u16* end = dst + wordCount;
+    u16 flags = 0;
+    u16 flagsLeft = 0;
+
+    while (dst < end)
+    {
+        if (flagsLeft == 0)
+        {
+            flags = *src;
+            src++;
+            flagsLeft = 16;
+        }
+
+        if (flags & 0x8000)
+        {
+            // The copy can overlap what it's writing, which repeats the last few words.
+            const u16* from = dst - ((*src & 0x07FF) + 1);
+            u16 count = (*src >> 11) + 2;
+            src++;
+
+            for (; count != 0; count--)
+            {
+                *dst = *from;
+                dst++;
+                from++;
+            }
+        }
+        else
+        {
+            *dst = *src;
+            dst++;
+            src++;
+        }
+
+        flags <<= 1;
+        flagsLeft--;
+    }
+}
+
+bool TileDecoder_loadTiles(const u16* data, const u16* blocks, u16 tileCount, u16 blockTiles, u16 index)
+{
+    if (blockTiles > TILEDECODER_MAX_BLOCK_TILES)
+    {
+        return FALSE;
+    }
+
+    u16* buffer = DMAScheduler_allocStaging(blockTiles * (TILE_WORDS << 1));
+    if (buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    u16 tile;
+    for (tile = 0; tile < tileCount; tile += blockTiles)
+    {
+        u16 count = tileCount - tile;
+        if (count > blockTiles)
+        {
+            count = blockTiles;
+        }
+
+        TileDecoder_decodeBlock(data + *blocks, buffer, count * TILE_WORDS);
+        DMA_doDma(DMA_VRAM, buffer, (index + tile) << 5, count * TILE_WORDS, 2);
+        blocks++;
+    }
+
+    DMAScheduler_freeStaging(buffer);
+    return TRUE;
+}
@@ -0,0 +1,26 @@
+#ifndef TILEDECODER_H
+#define TILEDECODER_H
+
+#include <genesis.h>
+
+// Tilesets compressed by tools/MapBaker.py's "compressed" command.  Each block of tiles is compressed on its own, so
+// it can be decoded into the DMA staging RAM and sent to VRAM before the next block is decoded.  The format is LZ over
+// whole words (four pixels), so decoding is only word copies:
+//
+//     A flag word, then one item per flag bit, most significant first, until the next flag word.  A clear bit is a
+//     literal word.  A set bit is a match word: copy (word >> 11) + 2 words from (word & 0x7FF) + 1 words back in the
+//     block's output.
+//
+// A block is at most 64 tiles (2KB, all of DMA_STAGING_SIZE).
+#define TILEDECODER_MAX_BLOCK_TILES 64
+
+// Decode wordCount words of one block from src into dst.
+void TileDecoder_decodeBlock(const u16* src, u16* dst, u16 wordCount);
+
+// Decode tileCount tiles into VRAM from tile index onwards, a block at a time.  data and blocks are a compressed
+// tileset and its block offsets, blockTiles tiles to a block.  The 68000 is held while the VDP takes each block, so
+// decoding and DMA take turns.  Needs as much staging RAM as a block, so call it when nothing is waiting to be sent
+// (at init, say).  Returns FALSE, having loaded nothing, if the staging RAM isn't free.
+bool TileDecoder_loadTiles(const u16* data, const u16* blocks, u16 tileCount, u16 blockTiles, u16 index);
+
+#endif // TILEDECODER_H
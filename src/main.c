@@ -1,8 +1,44 @@
 #include <genesis.h>
+#include "BenchmarkSuite.h"
+#include "DemoRecording.h"
+#include "DMAScheduler.h"
 #include "graphics.h"
+#include "Hud.h"
 #include "JoypadHandler.h"
+#include "PerfLog.h"
+#include "Profiler.h"
 #include "ScrollingMap.h"
 
+// Where the camera's input comes from: JOYPAD_MODE_LIVE reads the joypad, JOYPAD_MODE_RECORD also records it into
+// SRAM, and JOYPAD_MODE_REPLAY plays a recording back so that runs of different builds can be compared frame by frame.
+#define INPUT_MODE JOYPAD_MODE_LIVE
+
+// With JOYPAD_MODE_REPLAY, play demoRecording from ROM rather than the recording in SRAM.
+#define INPUT_REPLAY_FROM_ROM 1
+
+#if (BENCHMARK != 0 && PROFILER_ENABLED == 0)
+#error "BENCHMARK needs PROFILER_ENABLED to count scanlines"
+#endif
+
+// The benchmark measures the engine on its own, so it goes without the HUD.
+#if (HUD_ENABLED != 0 && BENCHMARK == 0)
+#define SHOW_HUD 1
+#else
+#define SHOW_HUD 0
+#endif
+
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+// Sky, hills and foreground scenery, Sonic style.
+const ParallaxBand parallaxBands[] =
+{
+    { 0, FIX16(0.25) },
+    { 64, FIX16(0.375) },
+    { 144, FIX16(0.5) }
+};
+#endif
+
+u16 getFrameScanlines();
+
 int main()
 {
     // Initialize the video processor, set screen resolution to 320x224
@@ -16,7 +52,11 @@ int main()
 
     // Set up VDP modes
     VDP_setHilightShadow(0);
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    VDP_setScrollingMode(HSCROLL_LINE, VSCROLL_PLANE);
+#else
     VDP_setScrollingMode(HSCROLL_PLANE, VSCROLL_PLANE);
+#endif
 
     // Load palettes
     VDP_setPalette(PAL0, PAL_BG);
@@ -26,13 +66,88 @@ int main()
     VDP_setPalette(PAL3, palette_blue);
     VDP_setPaletteColor((PAL3 * 16) + 15, 0x0eee);  // Text color
 
+    DMAScheduler_init();
     ScrollingMap_init();
+    ScrollingMap_setLagPolicy(SCROLLINGMAP_LAG_POLICY_CATCH_UP);
+#if (SCROLLINGMAP_LINE_SCROLL != 0)
+    ScrollingMap_setParallaxBands(parallaxBands, sizeof(parallaxBands) / sizeof(ParallaxBand));
+#endif
+
+    // Start after ScrollingMap_init has put the camera back at the top left, so a replay sees what was recorded.
+#if (BENCHMARK != 0)
+    BenchmarkSuite_init();
+#elif (INPUT_MODE == JOYPAD_MODE_RECORD)
+    Joypad_recordToSram();
+#elif (INPUT_MODE == JOYPAD_MODE_REPLAY && INPUT_REPLAY_FROM_ROM != 0)
+    Joypad_replay(demoRecording, demoRecordingRunCount);
+#elif (INPUT_MODE == JOYPAD_MODE_REPLAY)
+    // Nothing recorded yet means the joypad is read as usual.
+    Joypad_replayFromSram();
+#endif
+
+    Profiler_init();
+    PerfLog_init();
+#if (SHOW_HUD != 0)
+    Hud_init();
+#endif
 
     while(1)
     {
+        Profiler_beginZone(PROFILER_ZONE_FRAME);
+
+        Profiler_beginZone(PROFILER_ZONE_JOYPAD);
+#if (BENCHMARK != 0)
+        if (!BenchmarkSuite_update())
+        {
+            BenchmarkSuite_showResults();
+            while (1)
+            {
+                SYS_doVBlankProcess();
+            }
+        }
+#else
         Joypad_update();
+#endif
+        Profiler_endZone(PROFILER_ZONE_JOYPAD);
+
+#if (SHOW_HUD != 0)
+        if (Joypad_wasPressed(BUTTON_START))
+        {
+            Hud_setVisible(!Hud_isVisible());
+        }
+#endif
+
+        Profiler_beginZone(PROFILER_ZONE_SCROLLINGMAP);
         ScrollingMap_update();
+        Profiler_endZone(PROFILER_ZONE_SCROLLINGMAP);
+
+#if (SHOW_HUD != 0)
+        Hud_update(getFrameScanlines(), DMAScheduler_getLastFrameBytes(), ScrollingMap_getSeamsDrawn(),
+            ScrollingMap_getTotalLagFrames(), fgCameraPixelX, fgCameraPixelY);
+#endif
+
+        Profiler_beginZone(PROFILER_ZONE_DMA_FLUSH);
+        DMAScheduler_flush();
+        Profiler_endZone(PROFILER_ZONE_DMA_FLUSH);
+
+        Profiler_endZone(PROFILER_ZONE_FRAME);
+        PerfLog_record(getFrameScanlines(), DMAScheduler_getLastFrameBytes(), ScrollingMap_getSeamsDrawn(),
+            ScrollingMap_getLagFrames());
+#if (BENCHMARK != 0)
+        BenchmarkSuite_record(getFrameScanlines(), DMAScheduler_getLastFrameBytes());
+#endif
         SYS_doVBlankProcess();
+        DMAScheduler_releaseStaging();
         ScrollingMap_updateVDP();
     }
 }
+
+// Scanlines the main loop took the last time it finished, if the profiler is on.
+u16 getFrameScanlines()
+{
+#if (PROFILER_ENABLED != 0)
+    return Profiler_getZone(PROFILER_ZONE_FRAME)->lastLines;
+#else
+    return 0;
+#endif
+}
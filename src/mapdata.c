@@ -0,0 +1,1394 @@
+/* Autogenerated by MapBaker */
+
+#include "graphics.h"
+#include "mapdata.h"
+
+const uint16_t TILEMAP_FG_VDP[TILEMAP_FG_VDP_TILE_COUNT] =
+{
+    0x23a7, 0x2ba7, 0x23a7, 0x2ba7, 0x23a7, 0x2ba7, 0x23a7, 0x23a8, 0x23a9, 0x23aa, 0x23ab, 0x23aa, 0x23ac, 0x23ad, 0x23ac, 0x23ae, 0x23af, 0x23b0, 0x23b1, 0x23b2, 0x23b3, 0x23b3, 0x23ad, 0x23ab, 0x23b4, 0x23ae, 0x23b5, 0x23b6, 0x23b7, 0x23ae, 0x23b8, 0x23aa, 0x23b9, 0x23b2, 0x23ae, 0x23ba, 0x23bb, 0x23ae, 0x23bc, 0x23aa, 0x23ab, 0x23bd, 0x23b6, 0x23b9, 0x23ad, 0x23ab, 0x23ae, 0x23af, 0x23be, 0x23b6, 0x23bf, 0x23c0, 0x23c0, 0x23aa, 0x23b1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23c1, 0x2bc1, 0x23c1, 0x2bc1, 0x23c1, 0x2bc1, 0x23c1, 0x2bc1,
+    0x33a7, 0x3ba7, 0x33a7, 0x3ba7, 0x33a7, 0x3ba7, 0x33a7, 0x23c2, 0x23bc, 0x23b6, 0x23b0, 0x23c3, 0x23b4, 0x23b1, 0x23b2, 0x23bf, 0x23ab, 0x2bba, 0x23c4, 0x23ae, 0x23b2, 0x23b1, 0x23ad, 0x23b4, 0x23ad, 0x23ab, 0x23b6, 0x23b3, 0x23ae, 0x23ba, 0x23bb, 0x23ae, 0x23c5, 0x23aa, 0x23be, 0x23b1, 0x23aa, 0x23b3, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33c1, 0x3bc1, 0x33c1, 0x3bc1, 0x33c1, 0x3bc1, 0x33c1, 0x3bc1,
+    0x23a7, 0x2ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23c6, 0x23be, 0x23be, 0x23b7, 0x23c4, 0x23c7, 0x23c7, 0x23b2, 0x23b7, 0x23aa, 0x23ab, 0x23b4, 0x23b6, 0x23b9, 0x23aa, 0x23b6, 0x23b1, 0x23be, 0x23c8, 0x23b2, 0x23b1, 0x23b4, 0x23c7, 0x23b0, 0x23b2, 0x23ab, 0x23be, 0x23aa, 0x23ab, 0x23be, 0x23c7, 0x23b0, 0x23b6, 0x23ac, 0x23be, 0x23b3, 0x23aa, 0x23c9, 0x23b7, 0x23b3, 0x23b6, 0x23be, 0x23c0, 0x23b2, 0x23b1, 0x23b9, 0x23aa, 0x23b1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23c1, 0x2bc1,
+    0x33a7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ca, 0x23ac, 0x23aa, 0x2bba, 0x23ae, 0x23bf, 0x23ab, 0x2bba, 0x23aa, 0x23b1, 0x23ae, 0x23cb, 0x23cb, 0x23cc, 0x23ae, 0x23cd, 0x33ba, 0x23bf, 0x23ba, 0x23b3, 0x23ad, 0x23b0, 0x23ae, 0x23b8, 0x23b2, 0x23b9, 0x23b6, 0x23ad, 0x23ab, 0x2bcd, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33c1, 0x3bc1,
+    0x23a7, 0x2ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x23cf, 0x23d0, 0x2bd0, 0x23d0, 0x2bd0, 0x23d0, 0x2bd0, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d0, 0x2bd0, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23c1, 0x2bc1,
+    0x33a7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33c1, 0x3bc1,
+    0x23a7, 0x2ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23c1, 0x2bc1,
+    0x33a7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33c1, 0x3bc1,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23d1, 0x2bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x2bd2,
+    0x33d1, 0x3bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33d2, 0x3bd2,
+    0x23d1, 0x2bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x2bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x2bd2,
+    0x33d1, 0x3bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33ce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33d2, 0x3bd2,
+    0x23d1, 0x2bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x2bd2,
+    0x33d1, 0x3bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33d2, 0x3bd2,
+    0x23d1, 0x2bd1, 0x23d1, 0x2bd1, 0x23d1, 0x2bd1, 0x23d1, 0x2bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x2bd2, 0x23d2, 0x2bd2, 0x23d2, 0x2bd2, 0x23d2, 0x2bd2,
+    0x33d1, 0x3bd1, 0x33d1, 0x3bd1, 0x33d1, 0x3bd1, 0x33d1, 0x3bd1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x33d2, 0x3bd2, 0x33d2, 0x3bd2, 0x33d2, 0x3bd2, 0x33d2, 0x3bd2
+};
+
+const uint16_t TILEMAP_FG_VDP_COLUMNS[TILEMAP_FG_VDP_COLUMNS_TILE_COUNT] =
+{
+    0x23a7, 0x33a7, 0x23a7, 0x33a7, 0x23a7, 0x33a7, 0x23a7, 0x33a7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d1, 0x33d1, 0x23d1, 0x33d1, 0x23d1, 0x33d1, 0x23d1, 0x33d1,
+    0x2ba7, 0x3ba7, 0x2ba7, 0x3ba7, 0x2ba7, 0x3ba7, 0x2ba7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd1, 0x3bd1, 0x2bd1, 0x3bd1, 0x2bd1, 0x3bd1, 0x2bd1, 0x3bd1,
+    0x23a7, 0x33a7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d1, 0x33d1,
+    0x2ba7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd1, 0x3bd1,
+    0x23a7, 0x33a7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d1, 0x33d1,
+    0x2ba7, 0x3ba7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd1, 0x3bd1,
+    0x23a7, 0x33a7, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23d1, 0x33d1,
+    0x23a8, 0x23c2, 0x23ae, 0x23ae, 0x23cf, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bd1, 0x3bd1,
+    0x23a9, 0x23bc, 0x23c6, 0x23ca, 0x23d0, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23aa, 0x23b6, 0x23be, 0x23ac, 0x2bd0, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ab, 0x23b0, 0x23be, 0x23aa, 0x23d0, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23aa, 0x23c3, 0x23b7, 0x2bba, 0x2bd0, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ac, 0x23b4, 0x23c4, 0x23ae, 0x23d0, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ad, 0x23b1, 0x23c7, 0x23bf, 0x2bd0, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ac, 0x23b2, 0x23c7, 0x23ab, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23bf, 0x23b2, 0x2bba, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23af, 0x23ab, 0x23b7, 0x23aa, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b0, 0x2bba, 0x23aa, 0x23b1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b1, 0x23c4, 0x23ab, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b2, 0x23ae, 0x23b4, 0x23cb, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b3, 0x23b2, 0x23b6, 0x23cb, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b3, 0x23b1, 0x23b9, 0x23cc, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ad, 0x23ad, 0x23aa, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ab, 0x23b4, 0x23b6, 0x23cd, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b4, 0x23ad, 0x23b1, 0x33ba, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ab, 0x23be, 0x23bf, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b5, 0x23b6, 0x23c8, 0x23ba, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b6, 0x23b3, 0x23b2, 0x23b3, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b7, 0x23ae, 0x23b1, 0x23ad, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ba, 0x23b4, 0x23b0, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b8, 0x23bb, 0x23c7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23aa, 0x23ae, 0x23b0, 0x23b8, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b9, 0x23c5, 0x23b2, 0x23b2, 0x23d0, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b2, 0x23aa, 0x23ab, 0x23b9, 0x2bd0, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23be, 0x23be, 0x23b6, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ba, 0x23b1, 0x23aa, 0x23ad, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23bb, 0x23aa, 0x23ab, 0x23ab, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23b3, 0x23be, 0x2bcd, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23bc, 0x23ae, 0x23c7, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23aa, 0x23ae, 0x23b0, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ab, 0x23ae, 0x23b6, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23bd, 0x23ae, 0x23ac, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b6, 0x23ae, 0x23be, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b9, 0x23ae, 0x23b3, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ad, 0x23ae, 0x23aa, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ab, 0x23ae, 0x23c9, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23b7, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23af, 0x23ae, 0x23b3, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23be, 0x23ae, 0x23b6, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b6, 0x23ae, 0x23be, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23bf, 0x23ae, 0x23c0, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23c0, 0x23ae, 0x23b2, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23c0, 0x23ae, 0x23b1, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23aa, 0x23ae, 0x23b9, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23b1, 0x23ae, 0x23aa, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23b1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23c1, 0x33c1, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ce, 0x33ce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x33d2,
+    0x2bc1, 0x3bc1, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x2bce, 0x3bce, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd2, 0x3bd2,
+    0x23c1, 0x33c1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x33d2,
+    0x2bc1, 0x3bc1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd2, 0x3bd2,
+    0x23c1, 0x33c1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x33d2,
+    0x2bc1, 0x3bc1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd2, 0x3bd2,
+    0x23c1, 0x33c1, 0x23c1, 0x33c1, 0x23c1, 0x33c1, 0x23c1, 0x33c1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23d2, 0x33d2, 0x23d2, 0x33d2, 0x23d2, 0x33d2, 0x23d2, 0x33d2,
+    0x2bc1, 0x3bc1, 0x2bc1, 0x3bc1, 0x2bc1, 0x3bc1, 0x2bc1, 0x3bc1, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x23ae, 0x2bd2, 0x3bd2, 0x2bd2, 0x3bd2, 0x2bd2, 0x3bd2, 0x2bd2, 0x3bd2
+};
+
+const uint16_t TILEMAP_FG_CHUNKED_LAYOUT[TILEMAP_FG_CHUNKED_LAYOUT_COUNT] =
+{
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+    0x000a, 0x0006, 0x000b, 0x000c, 0x000d,
+    0x000e, 0x000f, 0x0010, 0x0011, 0x0012,
+    0x0013, 0x0014, 0x0014, 0x0014, 0x0015
+};
+
+const uint16_t TILEMAP_FG_CHUNKED_CHUNKS[TILEMAP_FG_CHUNKED_CHUNKS_COUNT] =
+{
+    0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005,
+    0x0000, 0x0006, 0x0006, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a,
+    0x0000, 0x0006, 0x0006, 0x000b, 0x000c, 0x000c, 0x000c, 0x0006,
+    0x0000, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015,
+    0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+    0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+    0x000c, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x002e, 0x002f, 0x0030, 0x0031, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0036, 0x0036, 0x0036, 0x0036,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0036,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0036,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0036,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0037, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0037, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006,
+    0x0037, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d, 0x000d, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x000d,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x000d, 0x000d, 0x000d, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0038,
+    0x0006, 0x000d, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0038,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0038,
+    0x0037, 0x0037, 0x0037, 0x0037, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0038, 0x0038, 0x0038, 0x0038,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+    0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039
+};
+
+const uint16_t TILEMAP_FG_CHUNKED_METATILES[TILEMAP_FG_CHUNKED_METATILES_COUNT] =
+{
+    0x23a7, 0x2ba7, 0x33a7, 0x3ba7,
+    0x23a7, 0x23a8, 0x33a7, 0x23c2,
+    0x23a9, 0x23aa, 0x23bc, 0x23b6,
+    0x23ab, 0x23aa, 0x23b0, 0x23c3,
+    0x23ac, 0x23ad, 0x23b4, 0x23b1,
+    0x23ac, 0x23ae, 0x23b2, 0x23bf,
+    0x23ae, 0x23ae, 0x23ae, 0x23ae,
+    0x23c6, 0x23be, 0x23ca, 0x23ac,
+    0x23be, 0x23b7, 0x23aa, 0x2bba,
+    0x23c4, 0x23c7, 0x23ae, 0x23bf,
+    0x23c7, 0x23b2, 0x23ab, 0x2bba,
+    0x23ce, 0x23cf, 0x33ce, 0x3bce,
+    0x23d0, 0x2bd0, 0x33ce, 0x3bce,
+    0x23ce, 0x2bce, 0x33ce, 0x3bce,
+    0x23af, 0x23b0, 0x23ab, 0x2bba,
+    0x23b1, 0x23b2, 0x23c4, 0x23ae,
+    0x23b3, 0x23b3, 0x23b2, 0x23b1,
+    0x23ad, 0x23ab, 0x23ad, 0x23b4,
+    0x23b4, 0x23ae, 0x23ad, 0x23ab,
+    0x23b5, 0x23b6, 0x23b6, 0x23b3,
+    0x23b7, 0x23ae, 0x23ae, 0x23ba,
+    0x23b8, 0x23aa, 0x23bb, 0x23ae,
+    0x23b7, 0x23aa, 0x23aa, 0x23b1,
+    0x23ab, 0x23b4, 0x23ae, 0x23cb,
+    0x23b6, 0x23b9, 0x23cb, 0x23cc,
+    0x23aa, 0x23b6, 0x23ae, 0x23cd,
+    0x23b1, 0x23be, 0x33ba, 0x23bf,
+    0x23c8, 0x23b2, 0x23ba, 0x23b3,
+    0x23b1, 0x23b4, 0x23ad, 0x23b0,
+    0x23c7, 0x23b0, 0x23ae, 0x23b8,
+    0x23b9, 0x23b2, 0x23c5, 0x23aa,
+    0x23ae, 0x23ba, 0x23be, 0x23b1,
+    0x23bb, 0x23ae, 0x23aa, 0x23b3,
+    0x23bc, 0x23aa, 0x23ae, 0x23ae,
+    0x23ab, 0x23bd, 0x23ae, 0x23ae,
+    0x23b6, 0x23b9, 0x23ae, 0x23ae,
+    0x23ad, 0x23ab, 0x23ae, 0x23ae,
+    0x23ae, 0x23af, 0x23ae, 0x23ae,
+    0x23b2, 0x23ab, 0x23b2, 0x23b9,
+    0x23be, 0x23aa, 0x23b6, 0x23ad,
+    0x23ab, 0x23be, 0x23ab, 0x2bcd,
+    0x23c7, 0x23b0, 0x23ae, 0x23ae,
+    0x23b6, 0x23ac, 0x23ae, 0x23ae,
+    0x23be, 0x23b3, 0x23ae, 0x23ae,
+    0x23aa, 0x23c9, 0x23ae, 0x23ae,
+    0x23b7, 0x23b3, 0x23ae, 0x23ae,
+    0x23be, 0x23b6, 0x23ae, 0x23ae,
+    0x23bf, 0x23c0, 0x23ae, 0x23ae,
+    0x23c0, 0x23aa, 0x23ae, 0x23ae,
+    0x23b1, 0x23ae, 0x23ae, 0x23ae,
+    0x23b6, 0x23be, 0x23ae, 0x23ae,
+    0x23c0, 0x23b2, 0x23ae, 0x23ae,
+    0x23b1, 0x23b9, 0x23ae, 0x23ae,
+    0x23aa, 0x23b1, 0x23ae, 0x23ae,
+    0x23c1, 0x2bc1, 0x33c1, 0x3bc1,
+    0x23d1, 0x2bd1, 0x33d1, 0x3bd1,
+    0x23d2, 0x2bd2, 0x33d2, 0x3bd2,
+    0x0000, 0x0000, 0x0000, 0x0000
+};
+
+const uint16_t* const TILEMAP_FG_ROWS[TILEMAP_FG_ROWS_COUNT] =
+{
+    TILEMAP_FG + 0, TILEMAP_FG + 80, TILEMAP_FG + 160, TILEMAP_FG + 240, TILEMAP_FG + 320, TILEMAP_FG + 400, TILEMAP_FG + 480, TILEMAP_FG + 560,
+    TILEMAP_FG + 640, TILEMAP_FG + 720, TILEMAP_FG + 800, TILEMAP_FG + 880, TILEMAP_FG + 960, TILEMAP_FG + 1040, TILEMAP_FG + 1120, TILEMAP_FG + 1200,
+    TILEMAP_FG + 1280, TILEMAP_FG + 1360, TILEMAP_FG + 1440, TILEMAP_FG + 1520, TILEMAP_FG + 1600, TILEMAP_FG + 1680, TILEMAP_FG + 1760, TILEMAP_FG + 1840,
+    TILEMAP_FG + 1920, TILEMAP_FG + 2000, TILEMAP_FG + 2080, TILEMAP_FG + 2160, TILEMAP_FG + 2240, TILEMAP_FG + 2320, TILEMAP_FG + 2400, TILEMAP_FG + 2480,
+    TILEMAP_FG + 2560, TILEMAP_FG + 2640, TILEMAP_FG + 2720, TILEMAP_FG + 2800, TILEMAP_FG + 2880, TILEMAP_FG + 2960, TILEMAP_FG + 3040, TILEMAP_FG + 3120,
+    TILEMAP_FG + 3200, TILEMAP_FG + 3280, TILEMAP_FG + 3360, TILEMAP_FG + 3440, TILEMAP_FG + 3520, TILEMAP_FG + 3600, TILEMAP_FG + 3680, TILEMAP_FG + 3760,
+    TILEMAP_FG + 3840, TILEMAP_FG + 3920, TILEMAP_FG + 4000, TILEMAP_FG + 4080, TILEMAP_FG + 4160, TILEMAP_FG + 4240, TILEMAP_FG + 4320, TILEMAP_FG + 4400,
+    TILEMAP_FG + 4480, TILEMAP_FG + 4560, TILEMAP_FG + 4640, TILEMAP_FG + 4720, TILEMAP_FG + 4800, TILEMAP_FG + 4880, TILEMAP_FG + 4960, TILEMAP_FG + 5040,
+    TILEMAP_FG + 5120, TILEMAP_FG + 5200
+};
+
+const uint16_t* const TILEMAP_FG_VDP_ROWS[TILEMAP_FG_VDP_ROWS_COUNT] =
+{
+    TILEMAP_FG_VDP + 0, TILEMAP_FG_VDP + 80, TILEMAP_FG_VDP + 160, TILEMAP_FG_VDP + 240, TILEMAP_FG_VDP + 320, TILEMAP_FG_VDP + 400, TILEMAP_FG_VDP + 480, TILEMAP_FG_VDP + 560,
+    TILEMAP_FG_VDP + 640, TILEMAP_FG_VDP + 720, TILEMAP_FG_VDP + 800, TILEMAP_FG_VDP + 880, TILEMAP_FG_VDP + 960, TILEMAP_FG_VDP + 1040, TILEMAP_FG_VDP + 1120, TILEMAP_FG_VDP + 1200,
+    TILEMAP_FG_VDP + 1280, TILEMAP_FG_VDP + 1360, TILEMAP_FG_VDP + 1440, TILEMAP_FG_VDP + 1520, TILEMAP_FG_VDP + 1600, TILEMAP_FG_VDP + 1680, TILEMAP_FG_VDP + 1760, TILEMAP_FG_VDP + 1840,
+    TILEMAP_FG_VDP + 1920, TILEMAP_FG_VDP + 2000, TILEMAP_FG_VDP + 2080, TILEMAP_FG_VDP + 2160, TILEMAP_FG_VDP + 2240, TILEMAP_FG_VDP + 2320, TILEMAP_FG_VDP + 2400, TILEMAP_FG_VDP + 2480,
+    TILEMAP_FG_VDP + 2560, TILEMAP_FG_VDP + 2640, TILEMAP_FG_VDP + 2720, TILEMAP_FG_VDP + 2800, TILEMAP_FG_VDP + 2880, TILEMAP_FG_VDP + 2960, TILEMAP_FG_VDP + 3040, TILEMAP_FG_VDP + 3120,
+    TILEMAP_FG_VDP + 3200, TILEMAP_FG_VDP + 3280, TILEMAP_FG_VDP + 3360, TILEMAP_FG_VDP + 3440, TILEMAP_FG_VDP + 3520, TILEMAP_FG_VDP + 3600, TILEMAP_FG_VDP + 3680, TILEMAP_FG_VDP + 3760,
+    TILEMAP_FG_VDP + 3840, TILEMAP_FG_VDP + 3920, TILEMAP_FG_VDP + 4000, TILEMAP_FG_VDP + 4080, TILEMAP_FG_VDP + 4160, TILEMAP_FG_VDP + 4240, TILEMAP_FG_VDP + 4320, TILEMAP_FG_VDP + 4400,
+    TILEMAP_FG_VDP + 4480, TILEMAP_FG_VDP + 4560, TILEMAP_FG_VDP + 4640, TILEMAP_FG_VDP + 4720, TILEMAP_FG_VDP + 4800, TILEMAP_FG_VDP + 4880, TILEMAP_FG_VDP + 4960, TILEMAP_FG_VDP + 5040,
+    TILEMAP_FG_VDP + 5120, TILEMAP_FG_VDP + 5200
+};
+
+const uint16_t TILESET_FG_LZ_BLOCKS[TILESET_FG_LZ_BLOCKS_COUNT] =
+{
+    0x0000
+};
+
+const uint16_t TILESET_FG_LZ[TILESET_FG_LZ_WORD_COUNT] =
+{
+    0x0840, 0x1111, 0x1111, 0x1444, 0x4444, 0x5001, 0x1111, 0x1112, 0x4444, 0x4445, 0x5001, 0x3000, 0x0000, 0x0066, 0x6660, 0x0660,
+    0x0000, 0xd4bb, 0x0801, 0x0005, 0x0660, 0x0009, 0x0000, 0x1800, 0x0066, 0x6600, 0x000b, 0x0666, 0x0815, 0x0007, 0x200f, 0x0666,
+    0x080f, 0x2000, 0xf2ff, 0x281f, 0x201b, 0x0023, 0x181f, 0x0006, 0x6000, 0x0811, 0x6000, 0x0005, 0x0001, 0x302f, 0x6000, 0x084d,
+    0x182d, 0x0001, 0x301f, 0xfffd, 0x1011, 0x1001, 0x585f, 0x1811, 0x407f, 0x1000, 0x201f, 0x205b, 0x505f, 0x087f, 0x101d, 0x00ad,
+    0x1881, 0x0008, 0x0666, 0x0000, 0x1fe2, 0x6666, 0x0660, 0x6066, 0x0007, 0x0001, 0x303f, 0x0814, 0x48cf, 0x20bf, 0x0805, 0x1861,
+    0x0666, 0x6000, 0x0660, 0x205f, 0x6600, 0xefff, 0x0009, 0x201f, 0x081b, 0x6666, 0x2041, 0x180d, 0x0801, 0x3031, 0x301f, 0x286f,
+    0x1831, 0x101b, 0x581f, 0x1054, 0x20be, 0x18b1, 0xefd3, 0x00a7, 0x013b, 0x20af, 0x0000, 0x287f, 0x313d, 0x288f, 0x081d, 0x0009,
+    0x2821, 0x0000, 0x019f, 0x1777, 0x7777, 0x5001, 0x619d, 0x3ffb, 0x1111, 0x1115, 0x285a, 0x0879, 0x10b5, 0x204f, 0x2039, 0x2005,
+    0x407b, 0x312f, 0x40bf, 0x282f, 0x0005, 0x6600, 0x0871, 0x0806, 0x7fe7, 0x0600, 0x5997, 0x383f, 0x1113, 0x28a9, 0x50ad, 0x1203,
+    0x398d, 0x1860, 0x298f, 0x100f, 0x6660, 0x0666, 0x386f, 0x08cf, 0x085f, 0xf212, 0x0801, 0x000d, 0x082f, 0x00cf, 0x1999, 0x9999,
+    0x5001, 0x1111, 0x1118, 0x9999, 0x9991, 0x5001, 0x5555, 0x5555, 0x681f, 0x1111, 0x3200, 0x1aaa, 0xaaaa, 0x5001, 0x000f, 0x1666,
+    0x6666, 0x5001
+};
+
+const uint16_t TILEMAP_BG_VDP[TILEMAP_BG_VDP_TILE_COUNT] =
+{
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x0004, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0006, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0007, 0x0008, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0009, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000a, 0x000b, 0x000c, 0x000d, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000e, 0x000f, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0010, 0x0011, 0x0012, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0013, 0x0014, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0015, 0x0016, 0x0017, 0x0018,
+    0x0001, 0x0001, 0x0019, 0x0001, 0x0001, 0x0001, 0x0001, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0022, 0x0023, 0x0024, 0x0025, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0026, 0x0027, 0x0028, 0x0001, 0x0029, 0x002a, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0001, 0x0001, 0x0001, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0001, 0x0001, 0x0001, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x0001, 0x0001, 0x0001, 0x0001, 0x0042, 0x004f, 0x0050, 0x0051, 0x0051, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0001, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c,
+    0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0007, 0x0078, 0x0001, 0x0001, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0001, 0x0001, 0x0001, 0x0861, 0x0080, 0x0081, 0x0082, 0x0051, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x0001, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x0051, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca,
+    0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00bf, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00bf, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x0051, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x00bf, 0x00bf, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101,
+    0x00bf, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x00bf, 0x0126, 0x0127, 0x0128, 0x0129, 0x012a, 0x012b, 0x012c, 0x012d, 0x012e, 0x012f, 0x0130, 0x0131, 0x00bf, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x00bf, 0x0138, 0x0139,
+    0x013a, 0x013b, 0x013c, 0x013d, 0x013e, 0x013f, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x014a, 0x014b, 0x014c, 0x014d, 0x014e, 0x014f, 0x0150, 0x1118, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015a, 0x015b, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168, 0x0169, 0x00bf, 0x00bf, 0x016a, 0x016b, 0x016c, 0x016d, 0x016e, 0x016f, 0x0170, 0x0171, 0x0172,
+    0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017a, 0x017b, 0x017c, 0x00bf, 0x017d, 0x017e, 0x017f, 0x0180, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x00bf, 0x0189, 0x018a, 0x018b, 0x018c, 0x018d, 0x018e, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0199, 0x019a, 0x019b, 0x019c, 0x019d, 0x019e, 0x019f, 0x01a0, 0x01a1, 0x00bf, 0x01a2, 0x01a3, 0x01a4, 0x01a5, 0x01a6, 0x01a7, 0x01a8, 0x01a9, 0x01aa, 0x01ab,
+    0x01ac, 0x01ad, 0x01ae, 0x01af, 0x01b0, 0x01b1, 0x01b2, 0x01b3, 0x01b4, 0x01b5, 0x01b6, 0x01b7, 0x01b8, 0x01b9, 0x01ba, 0x01bb, 0x01bc, 0x01bd, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x01c2, 0x01c3, 0x01c4, 0x01c5, 0x01c6, 0x00bf, 0x01c7, 0x01c8, 0x01c9, 0x01ca, 0x01cb, 0x01cc, 0x01cd, 0x01ce, 0x01cf, 0x01a5, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 0x01d4, 0x01d5, 0x01d6, 0x01d7, 0x01d8, 0x01d9, 0x01da, 0x01db, 0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e0, 0x01e1, 0x01e2, 0x01e3, 0x01e4, 0x01e5,
+    0x01e6, 0x01e7, 0x01e8, 0x01e9, 0x01ea, 0x01eb, 0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01f0, 0x01f1, 0x01f2, 0x01f3, 0x01f4, 0x01f5, 0x01f6, 0x01f7, 0x01f8, 0x01f9, 0x01fa, 0x01fb, 0x01fc, 0x01fd, 0x01fe, 0x01ff, 0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020a, 0x020b, 0x020c, 0x020d, 0x020e, 0x020f, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218, 0x0219, 0x021a, 0x021b, 0x021c, 0x021d, 0x021e, 0x021f, 0x0220, 0x0221,
+    0x0222, 0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022a, 0x022b, 0x022c, 0x022d, 0x022e, 0x022f, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023a, 0x023b, 0x023c, 0x023d, 0x023e, 0x023f, 0x0240, 0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024a, 0x024b, 0x024c, 0x024d, 0x024e, 0x024f, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025a, 0x025b, 0x025c, 0x025d,
+    0x025e, 0x025f, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026a, 0x026b, 0x026c, 0x026d, 0x026e, 0x026f, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027a, 0x027b, 0x027c, 0x027d, 0x027e, 0x027f, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028a, 0x028b, 0x028c, 0x028d, 0x028e, 0x028f, 0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x00da, 0x0297, 0x0298,
+    0x0299, 0x029a, 0x029b, 0x029c, 0x029d, 0x029e, 0x029f, 0x02a0, 0x02a1, 0x02a2, 0x02a3, 0x02a4, 0x02a5, 0x02a6, 0x02a7, 0x02a8, 0x02a9, 0x02aa, 0x02ab, 0x02ac, 0x02ad, 0x02ae, 0x02af, 0x02b0, 0x02b1, 0x02b2, 0x02b3, 0x02b4, 0x02b5, 0x02b6, 0x02b7, 0x02b8, 0x02b9, 0x02ba, 0x02bb, 0x02bc, 0x02bd, 0x02be, 0x02bf, 0x02c0, 0x02c1, 0x02c2, 0x02c3, 0x02c4, 0x02c5, 0x02c6, 0x02c7, 0x02c8, 0x02c9, 0x02ca, 0x02cb, 0x02cc, 0x02cd, 0x02ce, 0x02cf, 0x02d0, 0x02d1, 0x02d2, 0x02d3, 0x00bf,
+    0x02d4, 0x02d5, 0x02d6, 0x02d7, 0x02d8, 0x02d9, 0x02da, 0x02db, 0x02dc, 0x02dd, 0x02de, 0x02df, 0x02e0, 0x02e1, 0x02e2, 0x02e3, 0x02e4, 0x02e5, 0x02e6, 0x02e7, 0x02e8, 0x02e9, 0x02ea, 0x02eb, 0x02ec, 0x02ed, 0x02ee, 0x02ef, 0x02f0, 0x02f1, 0x02f2, 0x02f3, 0x02f4, 0x02f5, 0x02f6, 0x02f7, 0x02f8, 0x02f9, 0x02fa, 0x02fb, 0x02fc, 0x02fd, 0x02fe, 0x02ff, 0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030a, 0x030b, 0x030c, 0x030d, 0x030e, 0x030f,
+    0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317, 0x0318, 0x0319, 0x031a, 0x031b, 0x031c, 0x031d, 0x031e, 0x031f, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329, 0x032a, 0x032b, 0x032c, 0x032d, 0x032e, 0x032f, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337, 0x0338, 0x0339, 0x033a, 0x033b, 0x033c, 0x033d, 0x033e, 0x033f, 0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348, 0x0349, 0x034a, 0x034b,
+    0x031d, 0x034c, 0x034d, 0x034e, 0x034f, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358, 0x0359, 0x035a, 0x035b, 0x034f, 0x034f, 0x035c, 0x035d, 0x035e, 0x035f, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367, 0x0368, 0x0369, 0x036a, 0x036b, 0x036c, 0x036d, 0x036e, 0x036f, 0x0b1e, 0x0370, 0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377, 0x0378, 0x0379, 0x037a, 0x037b, 0x037c, 0x037d, 0x037e, 0x037f, 0x0380, 0x0381, 0x0382, 0x0383,
+    0x0384, 0x0385, 0x0386, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x0387, 0x0388, 0x0389, 0x0b87, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x038a, 0x038b, 0x038c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x038d, 0x038e, 0x038f, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x035a, 0x035a, 0x0398, 0x035a, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0b8c, 0x03a2, 0x03a3, 0x03a4, 0x039c, 0x03a5, 0x03a6,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f
+};
+
+const uint16_t TILEMAP_BG_VDP_COLUMNS[TILEMAP_BG_VDP_COLUMNS_TILE_COUNT] =
+{
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0035, 0x005d, 0x0091, 0x00cb, 0x00bf, 0x013a, 0x0173, 0x01ac, 0x01e6, 0x0222, 0x025e, 0x0299, 0x02d4, 0x0310, 0x031d, 0x0384, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0036, 0x005e, 0x0092, 0x00cc, 0x0102, 0x013b, 0x0174, 0x01ad, 0x01e7, 0x0223, 0x025f, 0x029a, 0x02d5, 0x0311, 0x034c, 0x0385, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0019, 0x0037, 0x005f, 0x0093, 0x00cd, 0x0103, 0x013c, 0x0175, 0x01ae, 0x01e8, 0x0224, 0x0260, 0x029b, 0x02d6, 0x0312, 0x034d, 0x0386, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0060, 0x0094, 0x00ce, 0x0104, 0x013d, 0x0176, 0x01af, 0x01e9, 0x0225, 0x0261, 0x029c, 0x02d7, 0x0313, 0x034e, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0061, 0x0095, 0x00cf, 0x0105, 0x013e, 0x0177, 0x01b0, 0x01ea, 0x0226, 0x0262, 0x029d, 0x02d8, 0x0314, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0062, 0x0096, 0x00d0, 0x0106, 0x013f, 0x0178, 0x01b1, 0x01eb, 0x0227, 0x0263, 0x029e, 0x02d9, 0x0315, 0x0350, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0038, 0x0063, 0x0097, 0x00d1, 0x0107, 0x0140, 0x0179, 0x01b2, 0x01ec, 0x0228, 0x0264, 0x029f, 0x02da, 0x0316, 0x0351, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x001a, 0x0039, 0x0064, 0x0098, 0x00d2, 0x0108, 0x0141, 0x017a, 0x01b3, 0x01ed, 0x0229, 0x0265, 0x02a0, 0x02db, 0x0317, 0x0352, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x001b, 0x003a, 0x0065, 0x0099, 0x00d3, 0x0109, 0x0142, 0x017b, 0x01b4, 0x01ee, 0x022a, 0x0266, 0x02a1, 0x02dc, 0x0318, 0x0353, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x001c, 0x003b, 0x0066, 0x009a, 0x00d4, 0x010a, 0x0143, 0x017c, 0x01b5, 0x01ef, 0x022b, 0x0267, 0x02a2, 0x02dd, 0x0319, 0x0354, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000a, 0x001d, 0x003c, 0x0067, 0x009b, 0x00d5, 0x010b, 0x0144, 0x00bf, 0x01b6, 0x01f0, 0x022c, 0x0268, 0x02a3, 0x02de, 0x031a, 0x0355, 0x0387, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0003, 0x000b, 0x001e, 0x003d, 0x0068, 0x009c, 0x00d6, 0x010c, 0x0145, 0x017d, 0x01b7, 0x01f1, 0x022d, 0x0269, 0x02a4, 0x02df, 0x031b, 0x0356, 0x0388, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0004, 0x000c, 0x001f, 0x003e, 0x0069, 0x009d, 0x00d7, 0x010d, 0x0146, 0x017e, 0x01b8, 0x01f2, 0x022e, 0x026a, 0x02a5, 0x02e0, 0x031c, 0x0357, 0x0389, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x000d, 0x0020, 0x003f, 0x006a, 0x009e, 0x00d8, 0x010e, 0x0147, 0x017f, 0x01b9, 0x01f3, 0x022f, 0x026b, 0x02a6, 0x02e1, 0x031d, 0x0358, 0x0b87, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0021, 0x0040, 0x006b, 0x009f, 0x00d9, 0x010f, 0x0148, 0x0180, 0x01ba, 0x01f4, 0x0230, 0x026c, 0x02a7, 0x02e2, 0x031e, 0x0359, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0041, 0x006c, 0x00a0, 0x00da, 0x0110, 0x0149, 0x0181, 0x01bb, 0x01f5, 0x0231, 0x026d, 0x02a8, 0x02e3, 0x031f, 0x035a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x006d, 0x00a1, 0x00db, 0x0111, 0x014a, 0x0182, 0x01bc, 0x01f6, 0x0232, 0x026e, 0x02a9, 0x02e4, 0x0320, 0x035b, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x006e, 0x00a2, 0x00dc, 0x0112, 0x014b, 0x0183, 0x01bd, 0x01f7, 0x0233, 0x026f, 0x02aa, 0x02e5, 0x0321, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x006f, 0x00a3, 0x00dd, 0x0113, 0x014c, 0x0184, 0x01be, 0x01f8, 0x0234, 0x0270, 0x02ab, 0x02e6, 0x0322, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0042, 0x0070, 0x00a4, 0x00de, 0x0114, 0x014d, 0x0185, 0x01bf, 0x01f9, 0x0235, 0x0271, 0x02ac, 0x02e7, 0x0323, 0x035c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0022, 0x0043, 0x0071, 0x00a5, 0x00df, 0x0115, 0x014e, 0x0186, 0x01c0, 0x01fa, 0x0236, 0x0272, 0x02ad, 0x02e8, 0x0324, 0x035d, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x000e, 0x0023, 0x0044, 0x0072, 0x00a6, 0x00e0, 0x0116, 0x014f, 0x0187, 0x01c1, 0x01fb, 0x0237, 0x0273, 0x02ae, 0x02e9, 0x0325, 0x035e, 0x038a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0006, 0x000f, 0x0024, 0x0045, 0x0073, 0x00a7, 0x00e1, 0x0117, 0x0150, 0x0188, 0x01c2, 0x01fc, 0x0238, 0x0274, 0x02af, 0x02ea, 0x0326, 0x035f, 0x038b, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0025, 0x0046, 0x0074, 0x00a8, 0x00bf, 0x0118, 0x1118, 0x00bf, 0x01c3, 0x01fd, 0x0239, 0x0275, 0x02b0, 0x02eb, 0x0327, 0x0360, 0x038c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0047, 0x0075, 0x00a9, 0x00e2, 0x0119, 0x0151, 0x0189, 0x01c4, 0x01fe, 0x023a, 0x0276, 0x02b1, 0x02ec, 0x0328, 0x0361, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0048, 0x0076, 0x00aa, 0x00e3, 0x011a, 0x0152, 0x018a, 0x01c5, 0x01ff, 0x023b, 0x0277, 0x02b2, 0x02ed, 0x0329, 0x0362, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0077, 0x00ab, 0x00e4, 0x011b, 0x0153, 0x018b, 0x01c6, 0x0200, 0x023c, 0x0278, 0x02b3, 0x02ee, 0x032a, 0x0363, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0007, 0x00ac, 0x00e5, 0x011c, 0x0154, 0x018c, 0x00bf, 0x0201, 0x023d, 0x0279, 0x02b4, 0x02ef, 0x032b, 0x0364, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0078, 0x00ad, 0x00e6, 0x011d, 0x0155, 0x018d, 0x01c7, 0x0202, 0x023e, 0x027a, 0x02b5, 0x02f0, 0x032c, 0x0365, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00ae, 0x00e7, 0x011e, 0x0156, 0x018e, 0x01c8, 0x0203, 0x023f, 0x027b, 0x02b6, 0x02f1, 0x032d, 0x0366, 0x038d, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00e8, 0x011f, 0x0157, 0x018f, 0x01c9, 0x0204, 0x0240, 0x027c, 0x02b7, 0x02f2, 0x032e, 0x0367, 0x038e, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0079, 0x00af, 0x00e9, 0x0120, 0x0158, 0x0190, 0x01ca, 0x0205, 0x0241, 0x027d, 0x02b8, 0x02f3, 0x032f, 0x0368, 0x038f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0010, 0x0026, 0x0049, 0x007a, 0x00b0, 0x00ea, 0x0121, 0x0159, 0x0191, 0x01cb, 0x0206, 0x0242, 0x027e, 0x02b9, 0x02f4, 0x0330, 0x0369, 0x0390, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0007, 0x0011, 0x0027, 0x004a, 0x007b, 0x00b1, 0x00bf, 0x0122, 0x015a, 0x0192, 0x01cc, 0x0207, 0x0243, 0x027f, 0x02ba, 0x02f5, 0x0331, 0x036a, 0x0391, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0008, 0x0012, 0x0028, 0x004b, 0x007c, 0x00b2, 0x00eb, 0x0123, 0x015b, 0x0193, 0x01cd, 0x0208, 0x0244, 0x0280, 0x02bb, 0x02f6, 0x0332, 0x036b, 0x0392, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x004c, 0x007d, 0x00b3, 0x00ec, 0x0124, 0x015c, 0x0194, 0x01ce, 0x0209, 0x0245, 0x0281, 0x02bc, 0x02f7, 0x0333, 0x036c, 0x0393, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0029, 0x004d, 0x007e, 0x00b4, 0x00ed, 0x0125, 0x015d, 0x0195, 0x01cf, 0x020a, 0x0246, 0x0282, 0x02bd, 0x02f8, 0x0334, 0x036d, 0x0394, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x002a, 0x004e, 0x007f, 0x00b5, 0x00ee, 0x00bf, 0x015e, 0x0196, 0x01a5, 0x020b, 0x0247, 0x0283, 0x02be, 0x02f9, 0x0335, 0x036e, 0x0395, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00b6, 0x00ef, 0x0126, 0x015f, 0x0197, 0x01d0, 0x020c, 0x0248, 0x0284, 0x02bf, 0x02fa, 0x0336, 0x036f, 0x0396, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00b7, 0x00f0, 0x0127, 0x0160, 0x0198, 0x01d1, 0x020d, 0x0249, 0x0285, 0x02c0, 0x02fb, 0x0337, 0x0b1e, 0x0397, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x00b8, 0x00f1, 0x0128, 0x0161, 0x0199, 0x01d2, 0x020e, 0x024a, 0x0286, 0x02c1, 0x02fc, 0x0338, 0x0370, 0x035a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0861, 0x00b9, 0x00f2, 0x0129, 0x0162, 0x019a, 0x01d3, 0x020f, 0x024b, 0x0287, 0x02c2, 0x02fd, 0x0339, 0x0371, 0x035a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0042, 0x0080, 0x00ba, 0x00f3, 0x012a, 0x0163, 0x019b, 0x01d4, 0x0210, 0x024c, 0x0288, 0x02c3, 0x02fe, 0x033a, 0x0372, 0x0398, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x004f, 0x0081, 0x00bb, 0x00f4, 0x012b, 0x0164, 0x019c, 0x01d5, 0x0211, 0x024d, 0x0289, 0x02c4, 0x02ff, 0x033b, 0x0373, 0x035a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0050, 0x0082, 0x0051, 0x0051, 0x012c, 0x0165, 0x019d, 0x01d6, 0x0212, 0x024e, 0x028a, 0x02c5, 0x0300, 0x033c, 0x0374, 0x0399, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x002b, 0x0051, 0x0051, 0x00bc, 0x00f5, 0x012d, 0x0166, 0x019e, 0x01d7, 0x0213, 0x024f, 0x028b, 0x02c6, 0x0301, 0x033d, 0x0375, 0x039a, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x002c, 0x0051, 0x0083, 0x00bd, 0x00f6, 0x012e, 0x0167, 0x019f, 0x01d8, 0x0214, 0x0250, 0x028c, 0x02c7, 0x0302, 0x033e, 0x0376, 0x039b, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x002d, 0x0051, 0x0084, 0x00be, 0x00f7, 0x012f, 0x0168, 0x01a0, 0x01d9, 0x0215, 0x0251, 0x028d, 0x02c8, 0x0303, 0x033f, 0x0377, 0x039c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0013, 0x002e, 0x0052, 0x0085, 0x00bf, 0x00f8, 0x0130, 0x0169, 0x01a1, 0x01da, 0x0216, 0x0252, 0x028e, 0x02c9, 0x0304, 0x0340, 0x0378, 0x039d, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0014, 0x002f, 0x0053, 0x0086, 0x00c0, 0x00f9, 0x0131, 0x00bf, 0x00bf, 0x01db, 0x0217, 0x0253, 0x028f, 0x02ca, 0x0305, 0x0341, 0x0379, 0x039e, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0030, 0x0054, 0x0087, 0x00c1, 0x00bf, 0x00bf, 0x00bf, 0x01a2, 0x01dc, 0x0218, 0x0254, 0x0290, 0x02cb, 0x0306, 0x0342, 0x037a, 0x039f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0055, 0x0088, 0x00c2, 0x00bf, 0x0132, 0x016a, 0x01a3, 0x01dd, 0x0219, 0x0255, 0x0291, 0x02cc, 0x0307, 0x0343, 0x037b, 0x03a0, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0056, 0x0089, 0x00c3, 0x00fa, 0x0133, 0x016b, 0x01a4, 0x01de, 0x021a, 0x0256, 0x0292, 0x02cd, 0x0308, 0x0344, 0x037c, 0x03a1, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x008a, 0x00c4, 0x00fb, 0x0134, 0x016c, 0x01a5, 0x01df, 0x021b, 0x0257, 0x0293, 0x02ce, 0x0309, 0x0345, 0x037d, 0x0b8c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0057, 0x008b, 0x00c5, 0x00fc, 0x0135, 0x016d, 0x01a6, 0x01e0, 0x021c, 0x0258, 0x0294, 0x02cf, 0x030a, 0x0346, 0x037e, 0x03a2, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0058, 0x008c, 0x00c6, 0x00fd, 0x0136, 0x016e, 0x01a7, 0x01e1, 0x021d, 0x0259, 0x0295, 0x02d0, 0x030b, 0x0347, 0x037f, 0x03a3, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0015, 0x0031, 0x0059, 0x008d, 0x00c7, 0x00fe, 0x0137, 0x016f, 0x01a8, 0x01e2, 0x021e, 0x025a, 0x0296, 0x02d1, 0x030c, 0x0348, 0x0380, 0x03a4, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0016, 0x0032, 0x005a, 0x008e, 0x00c8, 0x00ff, 0x00bf, 0x0170, 0x01a9, 0x01e3, 0x021f, 0x025b, 0x00da, 0x02d2, 0x030d, 0x0349, 0x0381, 0x039c, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0009, 0x0017, 0x0033, 0x005b, 0x008f, 0x00c9, 0x0100, 0x0138, 0x0171, 0x01aa, 0x01e4, 0x0220, 0x025c, 0x0297, 0x02d3, 0x030e, 0x034a, 0x0382, 0x03a5, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0018, 0x0034, 0x005c, 0x0090, 0x00ca, 0x0101, 0x0139, 0x0172, 0x01ab, 0x01e5, 0x0221, 0x025d, 0x0298, 0x00bf, 0x030f, 0x034b, 0x0383, 0x03a6, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f, 0x034f
+};
+
+const uint16_t TILEMAP_BG_CHUNKED_LAYOUT[TILEMAP_BG_CHUNKED_LAYOUT_COUNT] =
+{
+    0x0000, 0x0000, 0x0000, 0x0001,
+    0x0002, 0x0003, 0x0004, 0x0005,
+    0x0006, 0x0007, 0x0008, 0x0009
+};
+
+const uint16_t TILEMAP_BG_CHUNKED_CHUNKS[TILEMAP_BG_CHUNKED_CHUNKS_COUNT] =
+{
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0003, 0x0004, 0x0000,
+    0x0005, 0x0006, 0x0000, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b,
+    0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b,
+    0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b,
+    0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b,
+    0x0000, 0x0000, 0x003c, 0x003d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x003e, 0x003f, 0x0040, 0x0041, 0x0000, 0x0000, 0x0000,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+    0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+    0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069,
+    0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0073, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0074,
+    0x0075, 0x0076, 0x0077, 0x0000, 0x0000, 0x0078, 0x0079, 0x007a,
+    0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082,
+    0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a,
+    0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092,
+    0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a,
+    0x009b, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2,
+    0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa,
+    0x00ab, 0x0000, 0x0000, 0x0000, 0x00ac, 0x00ad, 0x0001, 0x0001,
+    0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0001, 0x0001,
+    0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x0001, 0x0001,
+    0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x0001, 0x0001,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x0001, 0x0001,
+    0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x0001, 0x0001,
+    0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x0001, 0x0001,
+    0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x0001, 0x0001,
+    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+    0x00e0, 0x00e1, 0x00e2, 0x00e2, 0x00e2, 0x00e3, 0x00e4, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5,
+    0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed,
+    0x00e2, 0x00e2, 0x00ee, 0x00ef, 0x00e2, 0x00e2, 0x00f0, 0x00f1,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5,
+    0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9,
+    0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2,
+    0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5,
+    0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0001, 0x0001,
+    0x0108, 0x0109, 0x010a, 0x010b, 0x010c, 0x010d, 0x0001, 0x0001,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x0001, 0x0001,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x0001, 0x0001,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x0001, 0x0001,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x0001, 0x0001,
+    0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x00e2, 0x0001, 0x0001,
+    0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x00e5, 0x0001, 0x0001
+};
+
+const uint16_t TILEMAP_BG_CHUNKED_METATILES[TILEMAP_BG_CHUNKED_METATILES_COUNT] =
+{
+    0x0001, 0x0001, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000,
+    0x0001, 0x0001, 0x0002, 0x0001,
+    0x0001, 0x0003, 0x000a, 0x000b,
+    0x0004, 0x0001, 0x000c, 0x000d,
+    0x0001, 0x0001, 0x0035, 0x0036,
+    0x0019, 0x0001, 0x0037, 0x0001,
+    0x0001, 0x001a, 0x0038, 0x0039,
+    0x001b, 0x001c, 0x003a, 0x003b,
+    0x001d, 0x001e, 0x003c, 0x003d,
+    0x001f, 0x0020, 0x003e, 0x003f,
+    0x0021, 0x0001, 0x0040, 0x0041,
+    0x005d, 0x005e, 0x0091, 0x0092,
+    0x005f, 0x0060, 0x0093, 0x0094,
+    0x0061, 0x0062, 0x0095, 0x0096,
+    0x0063, 0x0064, 0x0097, 0x0098,
+    0x0065, 0x0066, 0x0099, 0x009a,
+    0x0067, 0x0068, 0x009b, 0x009c,
+    0x0069, 0x006a, 0x009d, 0x009e,
+    0x006b, 0x006c, 0x009f, 0x00a0,
+    0x00cb, 0x00cc, 0x00bf, 0x0102,
+    0x00cd, 0x00ce, 0x0103, 0x0104,
+    0x00cf, 0x00d0, 0x0105, 0x0106,
+    0x00d1, 0x00d2, 0x0107, 0x0108,
+    0x00d3, 0x00d4, 0x0109, 0x010a,
+    0x00d5, 0x00d6, 0x010b, 0x010c,
+    0x00d7, 0x00d8, 0x010d, 0x010e,
+    0x00d9, 0x00da, 0x010f, 0x0110,
+    0x013a, 0x013b, 0x0173, 0x0174,
+    0x013c, 0x013d, 0x0175, 0x0176,
+    0x013e, 0x013f, 0x0177, 0x0178,
+    0x0140, 0x0141, 0x0179, 0x017a,
+    0x0142, 0x0143, 0x017b, 0x017c,
+    0x0144, 0x0145, 0x00bf, 0x017d,
+    0x0146, 0x0147, 0x017e, 0x017f,
+    0x0148, 0x0149, 0x0180, 0x0181,
+    0x01ac, 0x01ad, 0x01e6, 0x01e7,
+    0x01ae, 0x01af, 0x01e8, 0x01e9,
+    0x01b0, 0x01b1, 0x01ea, 0x01eb,
+    0x01b2, 0x01b3, 0x01ec, 0x01ed,
+    0x01b4, 0x01b5, 0x01ee, 0x01ef,
+    0x01b6, 0x01b7, 0x01f0, 0x01f1,
+    0x01b8, 0x01b9, 0x01f2, 0x01f3,
+    0x01ba, 0x01bb, 0x01f4, 0x01f5,
+    0x0222, 0x0223, 0x025e, 0x025f,
+    0x0224, 0x0225, 0x0260, 0x0261,
+    0x0226, 0x0227, 0x0262, 0x0263,
+    0x0228, 0x0229, 0x0264, 0x0265,
+    0x022a, 0x022b, 0x0266, 0x0267,
+    0x022c, 0x022d, 0x0268, 0x0269,
+    0x022e, 0x022f, 0x026a, 0x026b,
+    0x0230, 0x0231, 0x026c, 0x026d,
+    0x0299, 0x029a, 0x02d4, 0x02d5,
+    0x029b, 0x029c, 0x02d6, 0x02d7,
+    0x029d, 0x029e, 0x02d8, 0x02d9,
+    0x029f, 0x02a0, 0x02da, 0x02db,
+    0x02a1, 0x02a2, 0x02dc, 0x02dd,
+    0x02a3, 0x02a4, 0x02de, 0x02df,
+    0x02a5, 0x02a6, 0x02e0, 0x02e1,
+    0x02a7, 0x02a8, 0x02e2, 0x02e3,
+    0x0001, 0x0005, 0x0001, 0x000e,
+    0x0006, 0x0001, 0x000f, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0042,
+    0x0022, 0x0023, 0x0043, 0x0044,
+    0x0024, 0x0025, 0x0045, 0x0046,
+    0x0001, 0x0001, 0x0047, 0x0048,
+    0x006d, 0x006e, 0x00a1, 0x00a2,
+    0x006f, 0x0070, 0x00a3, 0x00a4,
+    0x0071, 0x0072, 0x00a5, 0x00a6,
+    0x0073, 0x0074, 0x00a7, 0x00a8,
+    0x0075, 0x0076, 0x00a9, 0x00aa,
+    0x0077, 0x0007, 0x00ab, 0x00ac,
+    0x0078, 0x0001, 0x00ad, 0x00ae,
+    0x0001, 0x0079, 0x0001, 0x00af,
+    0x00db, 0x00dc, 0x0111, 0x0112,
+    0x00dd, 0x00de, 0x0113, 0x0114,
+    0x00df, 0x00e0, 0x0115, 0x0116,
+    0x00e1, 0x00bf, 0x0117, 0x0118,
+    0x00e2, 0x00e3, 0x0119, 0x011a,
+    0x00e4, 0x00e5, 0x011b, 0x011c,
+    0x00e6, 0x00e7, 0x011d, 0x011e,
+    0x00e8, 0x00e9, 0x011f, 0x0120,
+    0x014a, 0x014b, 0x0182, 0x0183,
+    0x014c, 0x014d, 0x0184, 0x0185,
+    0x014e, 0x014f, 0x0186, 0x0187,
+    0x0150, 0x1118, 0x0188, 0x00bf,
+    0x0151, 0x0152, 0x0189, 0x018a,
+    0x0153, 0x0154, 0x018b, 0x018c,
+    0x0155, 0x0156, 0x018d, 0x018e,
+    0x0157, 0x0158, 0x018f, 0x0190,
+    0x01bc, 0x01bd, 0x01f6, 0x01f7,
+    0x01be, 0x01bf, 0x01f8, 0x01f9,
+    0x01c0, 0x01c1, 0x01fa, 0x01fb,
+    0x01c2, 0x01c3, 0x01fc, 0x01fd,
+    0x01c4, 0x01c5, 0x01fe, 0x01ff,
+    0x01c6, 0x00bf, 0x0200, 0x0201,
+    0x01c7, 0x01c8, 0x0202, 0x0203,
+    0x01c9, 0x01ca, 0x0204, 0x0205,
+    0x0232, 0x0233, 0x026e, 0x026f,
+    0x0234, 0x0235, 0x0270, 0x0271,
+    0x0236, 0x0237, 0x0272, 0x0273,
+    0x0238, 0x0239, 0x0274, 0x0275,
+    0x023a, 0x023b, 0x0276, 0x0277,
+    0x023c, 0x023d, 0x0278, 0x0279,
+    0x023e, 0x023f, 0x027a, 0x027b,
+    0x0240, 0x0241, 0x027c, 0x027d,
+    0x02a9, 0x02aa, 0x02e4, 0x02e5,
+    0x02ab, 0x02ac, 0x02e6, 0x02e7,
+    0x02ad, 0x02ae, 0x02e8, 0x02e9,
+    0x02af, 0x02b0, 0x02ea, 0x02eb,
+    0x02b1, 0x02b2, 0x02ec, 0x02ed,
+    0x02b3, 0x02b4, 0x02ee, 0x02ef,
+    0x02b5, 0x02b6, 0x02f0, 0x02f1,
+    0x02b7, 0x02b8, 0x02f2, 0x02f3,
+    0x0001, 0x0007, 0x0010, 0x0011,
+    0x0008, 0x0001, 0x0012, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0005,
+    0x0026, 0x0027, 0x0049, 0x004a,
+    0x0028, 0x0001, 0x004b, 0x004c,
+    0x0029, 0x002a, 0x004d, 0x004e,
+    0x0001, 0x0001, 0x0042, 0x004f,
+    0x0001, 0x002b, 0x0050, 0x0051,
+    0x002c, 0x002d, 0x0051, 0x0051,
+    0x007a, 0x007b, 0x00b0, 0x00b1,
+    0x007c, 0x007d, 0x00b2, 0x00b3,
+    0x007e, 0x007f, 0x00b4, 0x00b5,
+    0x0001, 0x0001, 0x00b6, 0x00b7,
+    0x0001, 0x0861, 0x00b8, 0x00b9,
+    0x0080, 0x0081, 0x00ba, 0x00bb,
+    0x0082, 0x0051, 0x0051, 0x00bc,
+    0x0083, 0x0084, 0x00bd, 0x00be,
+    0x00ea, 0x00bf, 0x0121, 0x0122,
+    0x00eb, 0x00ec, 0x0123, 0x0124,
+    0x00ed, 0x00ee, 0x0125, 0x00bf,
+    0x00ef, 0x00f0, 0x0126, 0x0127,
+    0x00f1, 0x00f2, 0x0128, 0x0129,
+    0x00f3, 0x00f4, 0x012a, 0x012b,
+    0x0051, 0x00f5, 0x012c, 0x012d,
+    0x00f6, 0x00f7, 0x012e, 0x012f,
+    0x0159, 0x015a, 0x0191, 0x0192,
+    0x015b, 0x015c, 0x0193, 0x0194,
+    0x015d, 0x015e, 0x0195, 0x0196,
+    0x015f, 0x0160, 0x0197, 0x0198,
+    0x0161, 0x0162, 0x0199, 0x019a,
+    0x0163, 0x0164, 0x019b, 0x019c,
+    0x0165, 0x0166, 0x019d, 0x019e,
+    0x0167, 0x0168, 0x019f, 0x01a0,
+    0x01cb, 0x01cc, 0x0206, 0x0207,
+    0x01cd, 0x01ce, 0x0208, 0x0209,
+    0x01cf, 0x01a5, 0x020a, 0x020b,
+    0x01d0, 0x01d1, 0x020c, 0x020d,
+    0x01d2, 0x01d3, 0x020e, 0x020f,
+    0x01d4, 0x01d5, 0x0210, 0x0211,
+    0x01d6, 0x01d7, 0x0212, 0x0213,
+    0x01d8, 0x01d9, 0x0214, 0x0215,
+    0x0242, 0x0243, 0x027e, 0x027f,
+    0x0244, 0x0245, 0x0280, 0x0281,
+    0x0246, 0x0247, 0x0282, 0x0283,
+    0x0248, 0x0249, 0x0284, 0x0285,
+    0x024a, 0x024b, 0x0286, 0x0287,
+    0x024c, 0x024d, 0x0288, 0x0289,
+    0x024e, 0x024f, 0x028a, 0x028b,
+    0x0250, 0x0251, 0x028c, 0x028d,
+    0x02b9, 0x02ba, 0x02f4, 0x02f5,
+    0x02bb, 0x02bc, 0x02f6, 0x02f7,
+    0x02bd, 0x02be, 0x02f8, 0x02f9,
+    0x02bf, 0x02c0, 0x02fa, 0x02fb,
+    0x02c1, 0x02c2, 0x02fc, 0x02fd,
+    0x02c3, 0x02c4, 0x02fe, 0x02ff,
+    0x02c5, 0x02c6, 0x0300, 0x0301,
+    0x02c7, 0x02c8, 0x0302, 0x0303,
+    0x0001, 0x0001, 0x0013, 0x0014,
+    0x0001, 0x0001, 0x0015, 0x0016,
+    0x0009, 0x0001, 0x0017, 0x0018,
+    0x002e, 0x002f, 0x0052, 0x0053,
+    0x0030, 0x0001, 0x0054, 0x0055,
+    0x0001, 0x0001, 0x0056, 0x0001,
+    0x0001, 0x0001, 0x0057, 0x0058,
+    0x0031, 0x0032, 0x0059, 0x005a,
+    0x0033, 0x0034, 0x005b, 0x005c,
+    0x0085, 0x0086, 0x00bf, 0x00c0,
+    0x0087, 0x0088, 0x00c1, 0x00c2,
+    0x0089, 0x008a, 0x00c3, 0x00c4,
+    0x008b, 0x008c, 0x00c5, 0x00c6,
+    0x008d, 0x008e, 0x00c7, 0x00c8,
+    0x008f, 0x0090, 0x00c9, 0x00ca,
+    0x00f8, 0x00f9, 0x0130, 0x0131,
+    0x00bf, 0x00bf, 0x00bf, 0x0132,
+    0x00fa, 0x00fb, 0x0133, 0x0134,
+    0x00fc, 0x00fd, 0x0135, 0x0136,
+    0x00fe, 0x00ff, 0x0137, 0x00bf,
+    0x0100, 0x0101, 0x0138, 0x0139,
+    0x0169, 0x00bf, 0x01a1, 0x00bf,
+    0x00bf, 0x016a, 0x01a2, 0x01a3,
+    0x016b, 0x016c, 0x01a4, 0x01a5,
+    0x016d, 0x016e, 0x01a6, 0x01a7,
+    0x016f, 0x0170, 0x01a8, 0x01a9,
+    0x0171, 0x0172, 0x01aa, 0x01ab,
+    0x01da, 0x01db, 0x0216, 0x0217,
+    0x01dc, 0x01dd, 0x0218, 0x0219,
+    0x01de, 0x01df, 0x021a, 0x021b,
+    0x01e0, 0x01e1, 0x021c, 0x021d,
+    0x01e2, 0x01e3, 0x021e, 0x021f,
+    0x01e4, 0x01e5, 0x0220, 0x0221,
+    0x0252, 0x0253, 0x028e, 0x028f,
+    0x0254, 0x0255, 0x0290, 0x0291,
+    0x0256, 0x0257, 0x0292, 0x0293,
+    0x0258, 0x0259, 0x0294, 0x0295,
+    0x025a, 0x025b, 0x0296, 0x00da,
+    0x025c, 0x025d, 0x0297, 0x0298,
+    0x02c9, 0x02ca, 0x0304, 0x0305,
+    0x02cb, 0x02cc, 0x0306, 0x0307,
+    0x02cd, 0x02ce, 0x0308, 0x0309,
+    0x02cf, 0x02d0, 0x030a, 0x030b,
+    0x02d1, 0x02d2, 0x030c, 0x030d,
+    0x02d3, 0x00bf, 0x030e, 0x030f,
+    0x0310, 0x0311, 0x031d, 0x034c,
+    0x0312, 0x0313, 0x034d, 0x034e,
+    0x0314, 0x0315, 0x034f, 0x0350,
+    0x0316, 0x0317, 0x0351, 0x0352,
+    0x0318, 0x0319, 0x0353, 0x0354,
+    0x031a, 0x031b, 0x0355, 0x0356,
+    0x031c, 0x031d, 0x0357, 0x0358,
+    0x031e, 0x031f, 0x0359, 0x035a,
+    0x0384, 0x0385, 0x034f, 0x034f,
+    0x0386, 0x034f, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x034f, 0x034f,
+    0x0387, 0x0388, 0x034f, 0x034f,
+    0x0389, 0x0b87, 0x034f, 0x034f,
+    0x034f, 0x034f, 0x0000, 0x0000,
+    0x0320, 0x0321, 0x035b, 0x034f,
+    0x0322, 0x0323, 0x034f, 0x035c,
+    0x0324, 0x0325, 0x035d, 0x035e,
+    0x0326, 0x0327, 0x035f, 0x0360,
+    0x0328, 0x0329, 0x0361, 0x0362,
+    0x032a, 0x032b, 0x0363, 0x0364,
+    0x032c, 0x032d, 0x0365, 0x0366,
+    0x032e, 0x032f, 0x0367, 0x0368,
+    0x034f, 0x038a, 0x034f, 0x034f,
+    0x038b, 0x038c, 0x034f, 0x034f,
+    0x034f, 0x038d, 0x034f, 0x034f,
+    0x038e, 0x038f, 0x034f, 0x034f,
+    0x0330, 0x0331, 0x0369, 0x036a,
+    0x0332, 0x0333, 0x036b, 0x036c,
+    0x0334, 0x0335, 0x036d, 0x036e,
+    0x0336, 0x0337, 0x036f, 0x0b1e,
+    0x0338, 0x0339, 0x0370, 0x0371,
+    0x033a, 0x033b, 0x0372, 0x0373,
+    0x033c, 0x033d, 0x0374, 0x0375,
+    0x033e, 0x033f, 0x0376, 0x0377,
+    0x0390, 0x0391, 0x034f, 0x034f,
+    0x0392, 0x0393, 0x034f, 0x034f,
+    0x0394, 0x0395, 0x034f, 0x034f,
+    0x0396, 0x0397, 0x034f, 0x034f,
+    0x035a, 0x035a, 0x034f, 0x034f,
+    0x0398, 0x035a, 0x034f, 0x034f,
+    0x0399, 0x039a, 0x034f, 0x034f,
+    0x039b, 0x039c, 0x034f, 0x034f,
+    0x0340, 0x0341, 0x0378, 0x0379,
+    0x0342, 0x0343, 0x037a, 0x037b,
+    0x0344, 0x0345, 0x037c, 0x037d,
+    0x0346, 0x0347, 0x037e, 0x037f,
+    0x0348, 0x0349, 0x0380, 0x0381,
+    0x034a, 0x034b, 0x0382, 0x0383,
+    0x039d, 0x039e, 0x034f, 0x034f,
+    0x039f, 0x03a0, 0x034f, 0x034f,
+    0x03a1, 0x0b8c, 0x034f, 0x034f,
+    0x03a2, 0x03a3, 0x034f, 0x034f,
+    0x03a4, 0x039c, 0x034f, 0x034f,
+    0x03a5, 0x03a6, 0x034f, 0x034f
+};
+
+const uint16_t* const TILEMAP_BG_ROWS[TILEMAP_BG_ROWS_COUNT] =
+{
+    TILEMAP_BG + 0, TILEMAP_BG + 60, TILEMAP_BG + 120, TILEMAP_BG + 180, TILEMAP_BG + 240, TILEMAP_BG + 300, TILEMAP_BG + 360, TILEMAP_BG + 420,
+    TILEMAP_BG + 480, TILEMAP_BG + 540, TILEMAP_BG + 600, TILEMAP_BG + 660, TILEMAP_BG + 720, TILEMAP_BG + 780, TILEMAP_BG + 840, TILEMAP_BG + 900,
+    TILEMAP_BG + 960, TILEMAP_BG + 1020, TILEMAP_BG + 1080, TILEMAP_BG + 1140, TILEMAP_BG + 1200, TILEMAP_BG + 1260, TILEMAP_BG + 1320, TILEMAP_BG + 1380,
+    TILEMAP_BG + 1440, TILEMAP_BG + 1500, TILEMAP_BG + 1560, TILEMAP_BG + 1620, TILEMAP_BG + 1680, TILEMAP_BG + 1740, TILEMAP_BG + 1800, TILEMAP_BG + 1860,
+    TILEMAP_BG + 1920, TILEMAP_BG + 1980, TILEMAP_BG + 2040, TILEMAP_BG + 2100, TILEMAP_BG + 2160, TILEMAP_BG + 2220, TILEMAP_BG + 2280, TILEMAP_BG + 2340,
+    TILEMAP_BG + 2400, TILEMAP_BG + 2460, TILEMAP_BG + 2520, TILEMAP_BG + 2580, TILEMAP_BG + 2640, TILEMAP_BG + 2700, TILEMAP_BG + 2760
+};
+
+const uint16_t* const TILEMAP_BG_VDP_ROWS[TILEMAP_BG_VDP_ROWS_COUNT] =
+{
+    TILEMAP_BG_VDP + 0, TILEMAP_BG_VDP + 60, TILEMAP_BG_VDP + 120, TILEMAP_BG_VDP + 180, TILEMAP_BG_VDP + 240, TILEMAP_BG_VDP + 300, TILEMAP_BG_VDP + 360, TILEMAP_BG_VDP + 420,
+    TILEMAP_BG_VDP + 480, TILEMAP_BG_VDP + 540, TILEMAP_BG_VDP + 600, TILEMAP_BG_VDP + 660, TILEMAP_BG_VDP + 720, TILEMAP_BG_VDP + 780, TILEMAP_BG_VDP + 840, TILEMAP_BG_VDP + 900,
+    TILEMAP_BG_VDP + 960, TILEMAP_BG_VDP + 1020, TILEMAP_BG_VDP + 1080, TILEMAP_BG_VDP + 1140, TILEMAP_BG_VDP + 1200, TILEMAP_BG_VDP + 1260, TILEMAP_BG_VDP + 1320, TILEMAP_BG_VDP + 1380,
+    TILEMAP_BG_VDP + 1440, TILEMAP_BG_VDP + 1500, TILEMAP_BG_VDP + 1560, TILEMAP_BG_VDP + 1620, TILEMAP_BG_VDP + 1680, TILEMAP_BG_VDP + 1740, TILEMAP_BG_VDP + 1800, TILEMAP_BG_VDP + 1860,
+    TILEMAP_BG_VDP + 1920, TILEMAP_BG_VDP + 1980, TILEMAP_BG_VDP + 2040, TILEMAP_BG_VDP + 2100, TILEMAP_BG_VDP + 2160, TILEMAP_BG_VDP + 2220, TILEMAP_BG_VDP + 2280, TILEMAP_BG_VDP + 2340,
+    TILEMAP_BG_VDP + 2400, TILEMAP_BG_VDP + 2460, TILEMAP_BG_VDP + 2520, TILEMAP_BG_VDP + 2580, TILEMAP_BG_VDP + 2640, TILEMAP_BG_VDP + 2700, TILEMAP_BG_VDP + 2760
+};
+
+const uint16_t TILESET_BG_LZ_BLOCKS[TILESET_BG_LZ_BLOCKS_COUNT] =
+{
+    0x0000, 0x0184, 0x033e, 0x050e, 0x06ee, 0x08dd, 0x0ae6, 0x0cdb, 0x0eec, 0x10f8, 0x1310, 0x1517, 0x16dc, 0x187a, 0x19fa
+};
+
+const uint16_t TILESET_BG_LZ[TILESET_BG_LZ_WORD_COUNT] =
+{
+    0x4d36, 0x0000, 0xc800, 0x0001, 0x1000, 0x0001, 0x280a, 0x1100, 0x0001, 0x0011, 0x1122, 0x1001, 0x6021, 0x2200, 0x7832, 0x400a,
+    0x0110, 0xa954, 0x0801, 0x1110, 0x701f, 0x0011, 0x400a, 0x1111, 0x1100, 0x0801, 0x3300, 0x0061, 0x0111, 0x3001, 0x1220, 0x0001,
+    0x1111, 0x1220, 0xd2a4, 0x584b, 0x0001, 0x0111, 0x0071, 0x0111, 0x1144, 0x2001, 0x1111, 0x1001, 0x4444, 0x0071, 0x2222, 0x2200,
+    0x0001, 0x5555, 0x2222, 0x92e5, 0x0001, 0x6622, 0x5522, 0x0001, 0x6666, 0x2222, 0x605e, 0x2220, 0x2035, 0x0837, 0x2001, 0x0001,
+    0x1111, 0x0081, 0x1112, 0x0801, 0x2b64, 0x1222, 0x1100, 0x0801, 0x2211, 0x0001, 0x1112, 0x502f, 0x2029, 0x0011, 0x0023, 0x0001,
+    0x0116, 0x6633, 0x0001, 0x1111, 0x1333, 0x8933, 0x1801, 0x3300, 0x1133, 0x0000, 0x0001, 0x3333, 0x5555, 0x2001, 0x3355, 0x5555,
+    0x482f, 0x084f, 0x1111, 0x1111, 0x390e, 0x1801, 0xfd2b, 0x280e, 0x10d7, 0x3001, 0x380f, 0x002b, 0x0800, 0x1177, 0x00d1, 0x1111,
+    0x1222, 0x4801, 0x1772, 0x001a, 0x2000, 0x2801, 0x00ab, 0xdfde, 0x1001, 0x593c, 0x1110, 0x0001, 0x692d, 0x412f, 0x006a, 0x1850,
+    0x4089, 0x0800, 0x1666, 0x0001, 0x0008, 0x200a, 0x1000, 0x6661, 0x929c, 0x0801, 0x1444, 0x4444, 0x0001, 0x1244, 0x4466, 0x0001,
+    0x1222, 0x0801, 0x1122, 0x2266, 0x0001, 0x0121, 0x0001, 0x6655, 0x5522, 0xaa4c, 0x0001, 0x5555, 0x2800, 0x2222, 0x1000, 0x2225,
+    0x0001, 0x5222, 0x2227, 0x0001, 0x5772, 0x2222, 0x0001, 0x1083, 0x5222, 0x2000, 0x93e5, 0x0001, 0x7772, 0x2220, 0x0001, 0x2227,
+    0x7222, 0x0001, 0x305f, 0x1801, 0x0873, 0x505f, 0x1111, 0x1113, 0x0801, 0x2211, 0x0001, 0x93fd, 0x1006, 0x1113, 0x4411, 0x0001,
+    0x3114, 0x5544, 0x0001, 0x310d, 0x082a, 0x1801, 0x383b, 0x197d, 0x0001, 0x1953, 0x1155, 0x0801, 0xe4db, 0x28af, 0x0151, 0x0001,
+    0x5555, 0x6666, 0x2001, 0x3355, 0x6655, 0x0001, 0x58ff, 0x1116, 0x0001, 0x500f, 0x6000, 0x0801, 0x590e, 0x7e59, 0x1111, 0x0001,
+    0x510b, 0x1000, 0x589f, 0x7000, 0x0877, 0x1155, 0x0000, 0x0801, 0x5555, 0x0001, 0x1000, 0x5577, 0x7711, 0x0001, 0x9e49, 0x504f,
+    0x1155, 0x5000, 0x0001, 0x104b, 0x1057, 0x1001, 0x0111, 0x1155, 0x0001, 0x1177, 0x7711, 0x0001, 0x7777, 0x1111, 0x0001, 0x6549,
+    0x7711, 0x0801, 0x1000, 0x1112, 0x2552, 0x0801, 0x2555, 0x0001, 0x1222, 0x2801, 0x2222, 0x2000, 0x0001, 0x5220, 0x0000, 0x0001,
+    0x2495, 0x5772, 0x2550, 0x0001, 0x5552, 0x2225, 0x0001, 0x5500, 0x6666, 0x0001, 0x5555, 0x2266, 0x0801, 0x2211, 0x0001, 0x2222,
+    0x002e, 0xe412, 0x031f, 0x09b3, 0x104b, 0x1111, 0x1116, 0x0801, 0x6666, 0x1111, 0x1166, 0x1111, 0x1550, 0x0001, 0x1116, 0x6550,
+    0x0001, 0x6665, 0x48e4, 0x5550, 0x1001, 0x6555, 0x5550, 0x4a79, 0x0001, 0x0006, 0x6111, 0x08f1, 0x1123, 0x0800, 0x1116, 0x6666,
+    0x0001, 0x1555, 0x1111, 0x6395, 0x6555, 0x0031, 0x2235, 0x1177, 0x6666, 0x6611, 0x0001, 0x003c, 0x0000, 0x1176, 0x6661, 0x0001,
+    0x6666, 0x0801, 0x1116, 0x1001, 0xd208, 0x0823, 0x181f, 0x1444, 0x0001, 0x1667, 0x7666, 0x0001, 0x6666, 0x6556, 0x6445, 0x5555,
+    0x1111, 0x0074, 0x2222, 0x4444, 0x4422, 0x904c, 0x0001, 0x6444, 0x6666, 0x0801, 0x4455, 0x5444, 0x4455, 0x4466, 0x6655, 0x0001,
+    0x2222, 0x2255, 0x0801, 0x0800, 0x5555, 0x6655, 0x9d70, 0x0001, 0x5775, 0x5222, 0x0001, 0x31fb, 0x1000, 0x2225, 0x0801, 0x5222,
+    0x01fd, 0x0004, 0x2000, 0x5775, 0x55c5, 0x0000, 0x0800, 0x2200, 0x0801, 0x5522, 0x1001, 0x2200, 0x0001, 0x100f, 0x3800, 0x0011,
+    0x0000, 0x1111, 0x1001, 0x0011, 0x0801, 0xb250, 0x3800, 0x1113, 0x0801, 0x4800, 0x3114, 0x5544, 0x0001, 0x1111, 0x5511, 0x0801,
+    0x4411, 0x0001, 0x1331, 0x4411, 0x1113, 0x4433, 0x2850, 0x1122, 0x1100, 0x0801, 0x2211, 0x2001, 0x1111, 0x3322, 0x1111, 0x3333,
+    0x304a, 0x1100, 0x0801, 0x1111, 0x1000, 0x1111, 0x1001, 0xa582, 0x505e, 0x0110, 0x0811, 0x0001, 0x1111, 0x0801, 0x1116, 0x0801,
+    0x1007, 0x1111, 0x0111, 0x1111, 0x1666, 0x6333, 0x0001, 0x6663, 0x481a, 0x3333, 0x0001, 0x1111, 0x1555, 0x0001, 0x1115, 0x5555,
+    0x1555, 0x5533, 0x3355, 0x5555, 0x0001, 0x1800, 0x6666, 0x0801, 0x5566, 0xca89, 0x000b, 0x1037, 0x5500, 0x0111, 0x0801, 0x1111,
+    0x0001, 0x5555, 0x0076, 0x1113, 0x0111, 0x1666, 0x0001, 0x1111, 0x1660, 0x0001, 0x206c, 0x1116, 0x6660, 0x0001, 0x1336, 0x6665,
+    0x3336, 0x6555, 0x6000, 0x0000, 0x0001, 0x3000, 0x5000, 0x0801, 0x1000, 0x0111, 0x1000, 0x9253, 0x0001, 0x1112, 0x2222, 0x0001,
+    0x1111, 0x1222, 0x00af, 0x0000, 0x0001, 0x0801, 0x0111, 0x0001, 0x2111, 0x1111, 0x1001, 0xc800, 0xcf38, 0x087f, 0x1081, 0x5577,
+    0x1111, 0x0001, 0x10de, 0x1001, 0x1086, 0x1155, 0x5550, 0x0001, 0x0878, 0x1892, 0x5544, 0x5555, 0x4444, 0x53f3, 0x4555, 0x3067,
+    0x5550, 0x0801, 0x5555, 0x5550, 0x0013, 0x593f, 0x0813, 0x1800, 0x0873, 0x20df, 0x0011, 0x1115, 0x00e1, 0x0001, 0xda14, 0x3800,
+    0x005e, 0x5111, 0x104b, 0x100a, 0x1511, 0x0801, 0x5511, 0x1177, 0x1555, 0x7777, 0x5082, 0x7711, 0x0803, 0x1222, 0x2555, 0xa560,
+    0x0001, 0x2222, 0x0801, 0x2227, 0x7555, 0x1001, 0x2225, 0x0060, 0x5225, 0x0801, 0x2800, 0x5557, 0x7777, 0x5777, 0x7222, 0x1111,
+    0x1c34, 0x1122, 0x2222, 0x2266, 0x0001, 0x191d, 0x1801, 0x1111, 0x1166, 0x6666, 0x1116, 0x0801, 0x1000, 0x6662, 0x0801, 0x6622,
+    0x6555, 0x57ee, 0x5550, 0x3001, 0x2555, 0x1001, 0x5551, 0x409b, 0x2089, 0x400f, 0x19a1, 0x300c, 0x1125, 0x1115, 0x0001, 0x01f7,
+    0x0199, 0x0111, 0x49b2, 0x1551, 0x0001, 0x1555, 0x5111, 0x0001, 0x5551, 0x1111, 0x0001, 0x0000, 0x6555, 0x0061, 0xc800, 0x1155,
+    0x1111, 0x007a, 0x1111, 0x4a34, 0x1664, 0x0001, 0x1116, 0x6444, 0x0001, 0x1166, 0x0801, 0x6666, 0x6444, 0x6445, 0x0923, 0x0801,
+    0x4445, 0x0001, 0x4441, 0x1111, 0x8158, 0x0001, 0x4111, 0x1445, 0x5444, 0x4455, 0x5644, 0x5555, 0x0001, 0x5666, 0x0801, 0x1566,
+    0x0801, 0x0800, 0x6655, 0x5555, 0x4466, 0xf492, 0x0801, 0x014a, 0x0001, 0x3000, 0x5775, 0x0001, 0x3555, 0x5777, 0x0001, 0x3337,
+    0x7555, 0x0001, 0x4333, 0x3555, 0x080d, 0x5557, 0xb924, 0x0001, 0x7555, 0x0801, 0x201c, 0x02a1, 0x5555, 0x2222, 0x0001, 0x7755,
+    0x5522, 0x0001, 0x7722, 0x5555, 0x0001, 0x5522, 0x2255, 0xab7d, 0x20ae, 0x2222, 0x1001, 0x2220, 0x0001, 0x5522, 0x0006, 0x5800,
+    0x2000, 0x38ec, 0x0001, 0x225f, 0x00e2, 0x5800, 0x1133, 0x68c0, 0x529f, 0x3111, 0x0803, 0x1331, 0x0001, 0x1113, 0x3331, 0x2801,
+    0x3551, 0x02d1, 0x1111, 0x5533, 0x0801, 0x11a5, 0x2001, 0x0299, 0x0033, 0x1ccc, 0x1133, 0x3311, 0x1111, 0x0001, 0x0018, 0x0001,
+    0x1144, 0x3377, 0x02d1, 0x100b, 0x3312, 0x2227, 0x0001, 0x0a5d, 0x1222, 0x7771, 0xd56f, 0x0003, 0x02e3, 0x1110, 0x0001, 0x7111,
+    0x0801, 0x2111, 0x0801, 0x2221, 0x495f, 0x0b4d, 0x0011, 0x001c, 0x295e, 0x02f7, 0x0293, 0x7af2, 0x1110, 0x0001, 0x0029, 0x481f,
+    0x1173, 0x0011, 0x0995, 0x1555, 0x0801, 0x0973, 0x2285, 0x0301, 0x5551, 0x1133, 0x0001, 0x1111, 0x7eb3, 0x1533, 0x0001, 0x0009,
+    0x0001, 0x00ff, 0x130f, 0x0001, 0x3333, 0x1001, 0x3355, 0x1001, 0x0301, 0x1111, 0x1333, 0x0001, 0x0328, 0xbd7e, 0x0801, 0x5333,
+    0x1001, 0x0301, 0x0132, 0x0001, 0x5335, 0x0801, 0x3335, 0x1801, 0x129b, 0x2001, 0x12a1, 0x0a8f, 0x63cd, 0x1111, 0x5275, 0x1111,
+    0x4000, 0x1221, 0x0001, 0x1222, 0x2111, 0x400e, 0x1112, 0x2111, 0x0001, 0x481d, 0x2000, 0x4445, 0x0803, 0x1115, 0x0801, 0x4d6e,
+    0x1555, 0x0001, 0x1555, 0x5555, 0x0001, 0x0000, 0x1115, 0x0002, 0x5444, 0x2801, 0x2800, 0x4444, 0x2800, 0x0008, 0x0801, 0x5544,
+    0x0af4, 0x4444, 0x4555, 0x4444, 0x1115, 0x0801, 0x4111, 0x0801, 0x1444, 0x0801, 0x0011, 0x1800, 0x103b, 0x4445, 0x0801, 0x4441,
+    0x1555, 0x16b4, 0x5550, 0x0000, 0x5555, 0x1001, 0x5500, 0x0801, 0x1800, 0x0000, 0x0000, 0x1111, 0x0001, 0x1000, 0x7777, 0x0800,
+    0x5555, 0x5577, 0x646c, 0x0011, 0x106d, 0x186f, 0x1175, 0x5111, 0x0001, 0x5551, 0x1111, 0x5555, 0x0803, 0x0001, 0x5111, 0x0801,
+    0x1800, 0x1117, 0x1555, 0x14e9, 0x7777, 0x1177, 0x7711, 0x0801, 0x5511, 0x0001, 0x1777, 0x1111, 0x0001, 0x0031, 0x0813, 0x2222,
+    0x2001, 0x1177, 0x7722, 0x0001, 0x0248, 0x7722, 0x2222, 0x2225, 0x5555, 0x2225, 0x5557, 0x0001, 0x2227, 0x7555, 0x0001, 0x2772,
+    0x2555, 0x0801, 0x2775, 0x5777, 0x7222, 0x3553, 0x7775, 0x5555, 0x0001, 0x4800, 0x6666, 0x1801, 0x5522, 0x0001, 0x7777, 0x0003,
+    0x5566, 0x0001, 0x6666, 0x6622, 0x0032, 0x0801, 0x445b, 0x6665, 0x0001, 0x2266, 0x6655, 0x6666, 0x0801, 0x2555, 0x5551, 0x5555,
+    0x4001, 0x5556, 0x0001, 0x510c, 0x6111, 0x0801, 0x08ac, 0x523f, 0x1100, 0x0801, 0x5555, 0x0001, 0x1155, 0x5511, 0x1048, 0x0011,
+    0x1111, 0x1155, 0x0801, 0x10af, 0x00b5, 0x105e, 0x2029, 0x406e, 0xdce1, 0x100c, 0x280e, 0x5511, 0x10c5, 0x002b, 0x080e, 0x1111,
+    0x5511, 0x0801, 0x0800, 0x083a, 0x6666, 0x6444, 0x1116, 0x6666, 0x0001, 0x2c49, 0x1111, 0x1666, 0x0001, 0x1156, 0x004c, 0x0873,
+    0x4111, 0x1445, 0x6111, 0x0801, 0x6443, 0x3334, 0x1001, 0x1663, 0x3333, 0x0001, 0x9188, 0x203a, 0x4555, 0x7755, 0x0801, 0x5577,
+    0x3555, 0x5555, 0x0001, 0x4800, 0x7755, 0x7755, 0x5577, 0x0001, 0x4333, 0x3555, 0x5443, 0x5092, 0x3336, 0x0001, 0x5553, 0x0801,
+    0x5554, 0x4336, 0x5555, 0x5335, 0x0801, 0x5555, 0x6555, 0x0801, 0x6666, 0x6555, 0x0001, 0x6555, 0x4354, 0x5665, 0x1024, 0x5522,
+    0x2255, 0x5555, 0x2222, 0x3801, 0x08f5, 0x5522, 0x0005, 0x1112, 0x0801, 0x5511, 0x0001, 0x2255, 0x5521, 0x21a8, 0x2222, 0x5511,
+    0x0001, 0x2000, 0x0000, 0x2000, 0x0001, 0x0001, 0x40e3, 0x0111, 0x50f0, 0x1144, 0x0801, 0x1133, 0x1111, 0x3333, 0xa112, 0x0001,
+    0x7733, 0x0801, 0x3344, 0x4411, 0x4444, 0x1111, 0x0001, 0x1111, 0x3111, 0x1133, 0x0801, 0x3333, 0x1113, 0x0001, 0x1155, 0xa267,
+    0x006b, 0x3335, 0x0001, 0x1113, 0x3551, 0x1333, 0x0801, 0x3335, 0x5551, 0x0001, 0x01a9, 0x5771, 0x1111, 0x0001, 0x08dc, 0x1910,
+    0xa138, 0x0a36, 0x5511, 0x11f5, 0x1144, 0x3377, 0x3311, 0x4477, 0x0001, 0x5555, 0x3311, 0x0801, 0x0131, 0x0801, 0x7771, 0x1222,
+    0x1111, 0xc213, 0x1001, 0x0800, 0x7711, 0x1111, 0x5517, 0x7111, 0x0001, 0x2221, 0x1111, 0x2221, 0x1110, 0x0001, 0x1222, 0x2110,
+    0x0801, 0x1a7d, 0x3cb7, 0x1000, 0x1111, 0x0151, 0x0001, 0x0085, 0x3087, 0x0000, 0x0011, 0x1001, 0x1100, 0x0801, 0x2a26, 0x1110,
+    0x1805, 0x096f, 0x08dc, 0x6e3f, 0x5557, 0x0001, 0x023e, 0x1000, 0x0801, 0x0255, 0x0a57, 0x5000, 0x7555, 0x5555, 0x0001, 0x082d,
+    0x0828, 0x1043, 0x0001, 0x2249, 0xd5f0, 0x0196, 0x0801, 0x5551, 0x0001, 0x1551, 0x017d, 0x1115, 0x0001, 0x213a, 0x1013, 0x1040,
+    0x0000, 0x3333, 0x3355, 0x3333, 0x6666, 0xa448, 0x0001, 0x5533, 0x1801, 0x5555, 0x3366, 0x0801, 0x5333, 0x6655, 0x3333, 0x0001,
+    0x5555, 0x6333, 0x0801, 0x6663, 0x5566, 0x5666, 0xff7b, 0x0001, 0x08e2, 0x0801, 0x1179, 0x0001, 0x1159, 0x1069, 0x3801, 0x2222,
+    0x0001, 0x0abf, 0x2800, 0x000a, 0x2222, 0x0800, 0x280c, 0x4777, 0x0001, 0x0801, 0x0111, 0x2202, 0x2222, 0x0001, 0x200b, 0x1b5f,
+    0x2112, 0x00e0, 0x0001, 0x20c4, 0x1122, 0x0800, 0x002b, 0x4168, 0xfcf1, 0x12c0, 0x2000, 0x5391, 0x4800, 0x197a, 0x2391, 0x4444,
+    0x4455, 0x0801, 0x0b6a, 0x219f, 0x420e, 0x1444, 0x4555, 0x4555, 0x0227, 0xd000, 0x521f, 0x2000, 0x5544, 0x600e, 0x1092, 0x4444,
+    0x4444, 0x5555, 0x5800, 0x4441, 0x1555, 0x5441, 0x1115, 0x0001, 0x5554, 0x4445, 0x0001, 0x5555, 0x5554, 0x6019, 0x4555, 0x2611,
+    0x5555, 0x5445, 0x0801, 0x5555, 0x5577, 0x180c, 0x0005, 0x5577, 0x5577, 0x7777, 0x5555, 0x0801, 0x5551, 0x1111, 0x5511, 0x0801,
+    0x4424, 0x7711, 0x0801, 0x7755, 0x5555, 0x1155, 0x0801, 0x1111, 0x1117, 0x1111, 0x1777, 0x0001, 0x1557, 0x7777, 0x0001, 0x5557,
+    0x7557, 0x851d, 0x1028, 0x7777, 0x7777, 0x7722, 0x2222, 0x0001, 0x7211, 0x0801, 0x7222, 0x2222, 0x5777, 0x0801, 0x100d, 0x0001,
+    0x5522, 0x1001, 0x10a1, 0x2277, 0x5522, 0x2255, 0x0001, 0x2772, 0x2775, 0x2227, 0x7227, 0x0801, 0x7111, 0x0001, 0x5552, 0x2221,
+    0x5555, 0x5662, 0x0801, 0x284f, 0x5555, 0x7555, 0x0801, 0x1775, 0x0801, 0x1117, 0x7555, 0x2222, 0x2225, 0x0001, 0x5555, 0x5566,
+    0x0001, 0x0059, 0x0001, 0x0870, 0x9292, 0x1878, 0x6666, 0x6665, 0x6001, 0x5555, 0x5556, 0x6001, 0x6666, 0x0800, 0x6111, 0x1111,
+    0x0001, 0x6666, 0x6611, 0x0801, 0x6655, 0xecf3, 0x0801, 0x0031, 0x0095, 0x1111, 0x0001, 0x1000, 0x5511, 0x1155, 0x0001, 0x1043,
+    0x180c, 0x2800, 0x5555, 0x5551, 0x0001, 0x500f, 0x9fc9, 0x3000, 0x1115, 0x5555, 0x0001, 0x0836, 0x0001, 0x0005, 0x20fe, 0x2808,
+    0x10ed, 0x5515, 0x5555, 0x0001, 0x5552, 0x2555, 0x0001, 0x4929, 0x5522, 0x0801, 0x1664, 0x4333, 0x0001, 0x5664, 0x4443, 0x0001,
+    0x5666, 0x6444, 0x0001, 0x5556, 0x0801, 0x3655, 0x5555, 0x0001, 0x5732, 0x3355, 0x0801, 0x4355, 0x0801, 0x4333, 0x0801, 0x1924,
+    0x0800, 0x5577, 0x7755, 0x0001, 0x103f, 0x7555, 0x5445, 0x0001, 0x5555, 0x4bc9, 0x5557, 0x0001, 0x7775, 0x5555, 0x0001, 0x5775,
+    0x0801, 0x1813, 0x0801, 0x100b, 0x5777, 0x7555, 0x0001, 0x5555, 0x5522, 0x0801, 0x94c9, 0x4800, 0x2222, 0x1155, 0x0801, 0x1111,
+    0x0001, 0x5555, 0x5521, 0x0801, 0x0800, 0x5111, 0x1111, 0x0001, 0x1111, 0x1444, 0x0801, 0x4924, 0x1115, 0x0001, 0x5554, 0x4444,
+    0x0001, 0x1114, 0x4555, 0x0001, 0x4555, 0x5511, 0x0001, 0x5554, 0x4333, 0x0001, 0x4443, 0x3344, 0x9e49, 0x0001, 0x4411, 0x1155,
+    0x0001, 0x10aa, 0x01d6, 0x0001, 0x4455, 0x3333, 0x0001, 0x5533, 0x3771, 0x0001, 0x3333, 0x1111, 0x0001, 0x994a, 0x1000, 0x3333,
+    0x4442, 0x0001, 0x30df, 0x1221, 0x1115, 0x0001, 0x2111, 0x0801, 0x1225, 0x5555, 0x0001, 0x1112, 0x0801, 0x5111, 0x93d2, 0x0801,
+    0x5552, 0x2255, 0x0001, 0x5555, 0x5771, 0x0801, 0x089f, 0x307f, 0x102b, 0x7111, 0x0801, 0x5771, 0x1777, 0x0001, 0x5777, 0x734b,
+    0x7777, 0x0001, 0x303f, 0x1013, 0x7777, 0x7711, 0x0001, 0x5934, 0x1122, 0x0001, 0x1554, 0x4557, 0x0801, 0x4445, 0x0001, 0x122c,
+    0x7892, 0x2222, 0x0800, 0x10db, 0x18dc, 0x024d, 0x5554, 0x2555, 0x5444, 0x0001, 0x5555, 0x0011, 0x0001, 0x5544, 0x1111, 0x0001,
+    0x4444, 0xd572, 0x2801, 0x1800, 0x1156, 0x0801, 0x1166, 0x0801, 0x4463, 0x0801, 0x1555, 0x0001, 0x01d4, 0x0001, 0x6666, 0x6555,
+    0x0001, 0x3333, 0x4f52, 0x3555, 0x0001, 0x5555, 0x3366, 0x0801, 0x0a03, 0x1801, 0x1000, 0x5333, 0x0001, 0x6655, 0x0801, 0x3355,
+    0x5553, 0x0001, 0x3333, 0xf3cf, 0x0801, 0x0020, 0x0001, 0x1027, 0x3335, 0x5555, 0x0001, 0x100b, 0x0130, 0x0001, 0x5557, 0x5522,
+    0x0001, 0x182b, 0x0a38, 0x1083, 0xe49e, 0x00d4, 0x0001, 0x3000, 0x5522, 0x2221, 0x0001, 0x5554, 0x4441, 0x0001, 0x4447, 0x7444,
+    0x0001, 0x02fb, 0x0000, 0x107e, 0x1114, 0xed39, 0x0145, 0x100a, 0x0000, 0x4446, 0x0001, 0x100f, 0x4411, 0x0801, 0x4444, 0x6666,
+    0x0001, 0x1000, 0x30da, 0x4444, 0x6644, 0x0001, 0x64ef, 0x6666, 0x0801, 0x50ee, 0x4444, 0x4441, 0x0001, 0x1144, 0x4444, 0x0001,
+    0x3227, 0x12ff, 0x6655, 0x0801, 0x3800, 0x0a5b, 0x51cb, 0xcff3, 0x1253, 0x1000, 0x5557, 0x7755, 0x0001, 0x01ec, 0x0801, 0x32d4,
+    0x20aa, 0x1801, 0x1000, 0x101a, 0x5777, 0x7755, 0x0001, 0x1186, 0x3ce7, 0x5577, 0x7711, 0x0001, 0x127b, 0x1277, 0x1000, 0x1155,
+    0x5557, 0x2001, 0x104b, 0x1001, 0x7555, 0x5557, 0x2001, 0x1834, 0x0967, 0x27c9, 0x7577, 0x2222, 0x2001, 0x7555, 0x2255, 0x0001,
+    0x135f, 0x110f, 0x1801, 0x2a57, 0x5557, 0x7666, 0x0001, 0x2666, 0x6666, 0x0001, 0x6000, 0x2776, 0x0801, 0x1000, 0x299a, 0x6665,
+    0x5557, 0x2801, 0x5555, 0x2001, 0x6666, 0x6665, 0x0801, 0x1800, 0x5566, 0x6665, 0x0001, 0x0810, 0x5556, 0x0001, 0x6555, 0x7244,
+    0x5552, 0x0801, 0x0807, 0x1001, 0x6556, 0x6655, 0x0001, 0x2222, 0x2555, 0x0001, 0x6222, 0x2255, 0x6552, 0x0801, 0x6665, 0x5222,
+    0x2426, 0x7766, 0x6655, 0x2001, 0x2277, 0x6666, 0x1001, 0x6622, 0x7766, 0x1111, 0x1555, 0x0001, 0x5555, 0x5115, 0x0801, 0x1800,
+    0x6655, 0xc525, 0x2006, 0x1039, 0x5666, 0x5556, 0x6666, 0x0001, 0x5666, 0x1801, 0x6664, 0x4466, 0x0801, 0x4444, 0x6444, 0x1001,
+    0x6666, 0x0021, 0xa108, 0x2001, 0x4455, 0x1801, 0x6633, 0x5555, 0x5522, 0x2555, 0x2001, 0x5552, 0x2555, 0x5555, 0x5552, 0x0801,
+    0x5222, 0x5666, 0x6664, 0xd2bf, 0x0801, 0x1835, 0x2556, 0x1801, 0x4433, 0x6655, 0x0001, 0x6444, 0x0801, 0x6644, 0x00a0, 0x0002,
+    0x0801, 0x2060, 0x1069, 0x103f, 0x6143, 0x3333, 0x2870, 0x3000, 0x5557, 0x7555, 0x5777, 0x7777, 0x0001, 0x5775, 0x0800, 0x5777,
+    0x7555, 0x5552, 0x2775, 0x0001, 0x004f, 0xa154, 0x1015, 0x7722, 0x0801, 0x5522, 0x2255, 0x5522, 0x2222, 0x0001, 0x5555, 0x0001,
+    0x2255, 0x0801, 0x2266, 0x0001, 0x2255, 0x2224, 0x6908, 0x2222, 0x1001, 0x000f, 0x5444, 0x0001, 0x6555, 0x5555, 0x0001, 0x4666,
+    0x6555, 0x4444, 0x4666, 0x0001, 0x2442, 0x2222, 0x4443, 0x48c9, 0x3411, 0x0001, 0x5444, 0x4111, 0x0001, 0x5555, 0x5455, 0x6555,
+    0x0801, 0x0094, 0x1122, 0x2211, 0x0001, 0x2222, 0x1133, 0x0001, 0xa288, 0x0846, 0x2211, 0x0801, 0x1111, 0x3355, 0x4222, 0x0801,
+    0x5551, 0x0801, 0x5333, 0x1111, 0x4444, 0x0001, 0x1133, 0x4223, 0x2111, 0x6136, 0x1111, 0x0001, 0x1000, 0x3551, 0x1111, 0x4331,
+    0x1117, 0x0001, 0x3111, 0x1775, 0x010c, 0x0001, 0x1115, 0x0801, 0x0005, 0x7555, 0xd219, 0x0801, 0x7800, 0x7755, 0x400a, 0x5511,
+    0x1111, 0x0001, 0x5541, 0x1111, 0x5111, 0x1777, 0x0801, 0x0005, 0x1111, 0x5551, 0x1845, 0xbbcf, 0x0000, 0x7711, 0x0800, 0x280a,
+    0x2000, 0x2222, 0x0801, 0x0869, 0x0801, 0x1800, 0x4444, 0x4555, 0x0001, 0x203f, 0x1069, 0x08bf, 0x490b, 0x5445, 0x0001, 0x5444,
+    0x4445, 0x0001, 0x5554, 0x4445, 0x1009, 0x2225, 0x5555, 0x5544, 0x1111, 0x0801, 0x7711, 0x0801, 0x0029, 0x5484, 0x1144, 0x0001,
+    0x4411, 0x0035, 0x6663, 0x0001, 0x1144, 0x6643, 0x0001, 0x4444, 0x4422, 0x4444, 0x2226, 0x0001, 0x4422, 0x2216, 0x2431, 0x3333,
+    0x3665, 0x0001, 0x3336, 0x6665, 0x0001, 0x2556, 0x6333, 0x6662, 0x2333, 0x1001, 0x308d, 0x3555, 0x5555, 0x3445, 0x0801, 0x5e48,
+    0x3335, 0x020f, 0x5566, 0x0801, 0x220f, 0x0801, 0x0166, 0x6633, 0x3556, 0x0001, 0x6666, 0x3555, 0x0001, 0x6655, 0x6335, 0x5555,
+    0x7ea7, 0x5663, 0x0001, 0x0011, 0x112b, 0x3031, 0x0001, 0x080e, 0x4444, 0x0001, 0x7744, 0x0801, 0x6644, 0x4444, 0x1833, 0x0006,
+    0x2800, 0xe73d, 0x01f0, 0x000a, 0x100c, 0x4446, 0x6666, 0x0001, 0x3013, 0x1000, 0x6444, 0x4466, 0x0001, 0x001c, 0x4001, 0x186a,
+    0x6611, 0x0001, 0x6b54, 0x6611, 0x00af, 0x0800, 0x4433, 0x0002, 0x4111, 0x0001, 0x18e8, 0x1114, 0x1009, 0x4441, 0x0007, 0x1666,
+    0x0001, 0x1116, 0x6665, 0x995d, 0x0001, 0x4446, 0x6551, 0x20ff, 0x1079, 0x1111, 0x5577, 0x0001, 0x1155, 0x200e, 0x1155, 0x000c,
+    0x0001, 0x1800, 0x1115, 0x000b, 0xd9c6, 0x0801, 0x0113, 0x5557, 0x2001, 0x020a, 0x5555, 0x5777, 0x1001, 0x1185, 0x4001, 0x7777,
+    0x7555, 0x7777, 0x0003, 0x7994, 0x5775, 0xf935, 0x0801, 0x0239, 0x1235, 0x0005, 0x4015, 0x5777, 0x1155, 0x0001, 0x5551, 0x1177,
+    0x09a4, 0x0001, 0x7755, 0x0001, 0x7777, 0x2801, 0xf3a2, 0x0070, 0x0001, 0x783c, 0x4000, 0x5552, 0x5522, 0x0269, 0x0a74, 0x0001,
+    0x5255, 0x11eb, 0x7755, 0x2555, 0x2255, 0x12c9, 0x5557, 0x4f3f, 0x7666, 0x1001, 0x5555, 0x5665, 0x0801, 0x093d, 0x3001, 0x5000,
+    0x6655, 0x5566, 0x0801, 0x031b, 0x016f, 0x0001, 0x038d, 0x1178, 0xfe33, 0x0801, 0x1013, 0x0342, 0x0b8d, 0x0801, 0x33ad, 0x0801,
+    0x5222, 0x6665, 0x5522, 0x0001, 0x104a, 0x5666, 0x6555, 0x0001, 0x0005, 0x9264, 0x0381, 0x2222, 0x2277, 0x0001, 0x2266, 0x2222,
+    0x0001, 0x5566, 0x6622, 0x0801, 0x0b5f, 0x7722, 0x5666, 0x0001, 0x2222, 0x6666, 0x9492, 0x0001, 0x1111, 0x2666, 0x0001, 0x6622,
+    0x0b4b, 0x6666, 0x6446, 0x0001, 0x6664, 0x4666, 0x0001, 0x6666, 0x6663, 0x0001, 0x4666, 0x0000, 0x6663, 0x1a14, 0x6444, 0x6666,
+    0x6446, 0x0801, 0x1000, 0x3666, 0x1801, 0x6633, 0x5555, 0x5533, 0x3355, 0x0001, 0x5544, 0x0801, 0x6644, 0x3333, 0xa30c, 0x0001,
+    0x4444, 0x000e, 0x5222, 0x5555, 0x5552, 0x0801, 0x3800, 0x2556, 0x6666, 0x2225, 0x5666, 0x0001, 0x1009, 0x5552, 0x2555, 0xc282,
+    0x0001, 0x0005, 0x6666, 0x6644, 0x6566, 0x6666, 0x0001, 0x5566, 0x3001, 0x6655, 0x3333, 0x6655, 0x4444, 0x3344, 0x0001, 0x6644,
+    0x5029, 0x4444, 0x0001, 0x6666, 0x0801, 0x5566, 0x4444, 0x5557, 0x7555, 0x4552, 0x2222, 0x0801, 0x2221, 0x0001, 0x4555, 0x5222,
+    0x0001, 0x948b, 0x0836, 0x5222, 0x2222, 0x0800, 0x1112, 0x0801, 0x2112, 0x2225, 0x0001, 0x5221, 0x1222, 0x5555, 0x000c, 0x5522,
+    0x0801, 0x0006, 0x1fa9, 0x5555, 0x5522, 0x2255, 0x0001, 0x001e, 0x101d, 0x0800, 0x080f, 0x2013, 0x2442, 0x000b, 0x2555, 0x0001,
+    0x5222, 0x2225, 0x0001, 0xef0c, 0x0889, 0x083f, 0x0072, 0x5225, 0x0801, 0x1000, 0x0014, 0x0001, 0x5772, 0x2211, 0x5555, 0x1111,
+    0x0034, 0x0001, 0x2222, 0x2255, 0xe092, 0x0001, 0x000a, 0x080c, 0x5522, 0x1133, 0x4223, 0x5555, 0x2221, 0x0001, 0x5522, 0x2333,
+    0x0001, 0x2222, 0x1113, 0x1001, 0x3111, 0x1297, 0x1775, 0x1113, 0x3555, 0x0001, 0x3333, 0x3554, 0x0801, 0x3444, 0x0001, 0x3334,
+    0x4444, 0x20c5, 0x4445, 0x0801, 0x000a, 0x1001, 0x0b92, 0x5541, 0x1111, 0x5555, 0x5111, 0x2801, 0x5557, 0x0801, 0x0041, 0x3800,
+    0x7111, 0x1115, 0x0001, 0x5775, 0x5775, 0x0808, 0x1122, 0xbb2a, 0x0801, 0x7722, 0x0001, 0x001a, 0x0001, 0x5111, 0x080e, 0x106b,
+    0x1111, 0x1155, 0x0801, 0x1144, 0x0801, 0x4444, 0x009e, 0x5554, 0x54d1, 0x4445, 0x0001, 0x4444, 0x1001, 0x4555, 0x0001, 0x5444,
+    0x4555, 0x00a6, 0x1800, 0x5551, 0x2801, 0x5444, 0x4411, 0x4444, 0x1001, 0x2a12, 0x1144, 0x4411, 0x0001, 0x4444, 0x002c, 0x1111,
+    0x011a, 0x4422, 0x2216, 0x2222, 0x1146, 0x0001, 0x1111, 0x4466, 0x0001, 0x1144, 0x8250, 0x1001, 0x6664, 0x6662, 0x2333, 0x6662,
+    0x2113, 0x0001, 0x6661, 0x1113, 0x0001, 0x6221, 0x0801, 0x4221, 0x1221, 0x3335, 0x5555, 0x8749, 0x5001, 0x1444, 0x4555, 0x5555,
+    0x6655, 0x417b, 0x1000, 0x2967, 0x6665, 0x0001, 0x5555, 0x5665, 0x1001, 0x6666, 0x6555, 0x1001, 0x2b21, 0x5444, 0x4665, 0x0001,
+    0x5664, 0x0801, 0x5554, 0x28df, 0x101a, 0x5666, 0x6677, 0x0001, 0x4666, 0x6677, 0x5566, 0x6644, 0x503d, 0x47ee, 0x7755, 0x00f1,
+    0x4444, 0x5545, 0x5554, 0x0001, 0x0097, 0x0801, 0x1800, 0x000f, 0x3000, 0x5555, 0x0015, 0x0001, 0x000f, 0x4466, 0x2614, 0x4466,
+    0x6644, 0x0001, 0x4655, 0x5555, 0x0001, 0x08ce, 0x4444, 0x5544, 0x4444, 0x4433, 0x0001, 0x3344, 0x2001, 0x4444, 0x3366, 0x813d,
+    0x0001, 0x4466, 0x4455, 0x4441, 0x1111, 0x4116, 0x6555, 0x0001, 0x4665, 0x5555, 0x0001, 0x2000, 0x010f, 0x589e, 0x5551, 0x0117,
+    0x63d8, 0x5511, 0x1000, 0x0005, 0x1155, 0x1155, 0x5555, 0x0001, 0x081f, 0x0805, 0x0807, 0x5566, 0x2001, 0x00b9, 0x5555, 0x5777,
+    0x5666, 0x5924, 0x6557, 0x0001, 0x6666, 0x1001, 0x18b9, 0x7777, 0x7555, 0x3001, 0x5777, 0x7755, 0x0001, 0x5555, 0x5755, 0x022f,
+    0x5557, 0x7777, 0x9052, 0x2001, 0x5777, 0x7117, 0x0001, 0x5111, 0x1771, 0x5551, 0x1177, 0x7777, 0x0800, 0x7771, 0x0801, 0x7117,
+    0x7766, 0x0001, 0x1777, 0x1f32, 0x6666, 0x7777, 0x7755, 0x1801, 0x0007, 0x1ab3, 0x0000, 0x407a, 0x6655, 0x5664, 0x1001, 0x22ab,
+    0x5666, 0x6555, 0x0001, 0x4444, 0x4fc9, 0x4665, 0x0801, 0x4445, 0x2555, 0x0a1c, 0x0801, 0x01bd, 0x0001, 0x4800, 0x1233, 0x7722,
+    0x7755, 0x0001, 0x5555, 0x7777, 0x080c, 0x452e, 0x5556, 0x5801, 0x5555, 0x6555, 0x5556, 0x0001, 0x6665, 0x0801, 0x6666, 0x6556,
+    0x0801, 0x6555, 0x02e0, 0x08b7, 0x0800, 0x5577, 0xafce, 0x1001, 0x7777, 0x0001, 0x6666, 0x0017, 0x2827, 0x2000, 0x0186, 0x0001,
+    0x10c7, 0x5666, 0x6665, 0x2001, 0x0177, 0x08c1, 0x7755, 0x9786, 0x0001, 0x5552, 0x2755, 0x0801, 0x2777, 0x0001, 0x08f1, 0x2001,
+    0x2800, 0x6622, 0x6664, 0x6666, 0x6663, 0x1801, 0x0378, 0x6444, 0xc099, 0x015d, 0x0001, 0x4666, 0x6663, 0x3666, 0x6333, 0x3446,
+    0x6334, 0x0001, 0x4443, 0x3444, 0x2001, 0x1383, 0x4666, 0x6644, 0x0801, 0x9ef2, 0x0019, 0x4444, 0x4664, 0x0801, 0x0381, 0x0b46,
+    0x0b4e, 0x4466, 0x0198, 0x1801, 0x1043, 0x1219, 0x4433, 0x3555, 0x0001, 0x4443, 0xfd2f, 0x0801, 0x0371, 0x089e, 0x295d, 0x1961,
+    0x002e, 0x4466, 0x1379, 0x6644, 0x4455, 0x0801, 0x6655, 0x0001, 0x1874, 0x11d9, 0x19dd, 0xce40, 0x0000, 0x0371, 0x5552, 0x2222,
+    0x0254, 0x0001, 0x12b1, 0x5444, 0x4444, 0x0001, 0x06bf, 0x5555, 0x5555, 0x2255, 0x5555, 0x5522, 0x0801, 0x1000, 0x4455, 0x0801,
+    0x5522, 0x000e, 0x1800, 0x1813, 0x000b, 0x280d, 0x2000, 0x4242, 0x5225, 0x0801, 0x5772, 0x2211, 0x5222, 0x2111, 0x3030, 0x5554,
+    0x4433, 0x0001, 0x1111, 0x5522, 0x1111, 0x1122, 0x1001, 0x4411, 0x6048, 0x1111, 0x0001, 0x1000, 0x2222, 0x1113, 0x2211, 0x1113,
+    0x1111, 0x1443, 0x2001, 0x1133, 0x3443, 0x0001, 0x3334, 0x4444, 0x3444, 0xe96d, 0x1801, 0x0007, 0x0801, 0x4445, 0x0001, 0x4444,
+    0x5555, 0x2001, 0x4555, 0x0801, 0x7800, 0x5775, 0x0001, 0x0800, 0x5551, 0x0806, 0x129a, 0x5555, 0x5557, 0x7555, 0x0001, 0x5555,
+    0x5777, 0x0001, 0x5111, 0x0853, 0x5111, 0x1155, 0x0001, 0x101e, 0x7755, 0x0801, 0x1111, 0xaa28, 0x083c, 0x5544, 0x1001, 0x4455,
+    0x0801, 0x5555, 0x0001, 0x5444, 0x4555, 0x5445, 0x403f, 0x5553, 0x0801, 0x5444, 0x5556, 0x6443, 0x2cf0, 0x5663, 0x3333, 0x0001,
+    0x5333, 0x0801, 0x1000, 0x3344, 0x4444, 0x0801, 0x0800, 0x0008, 0x2001, 0x1144, 0x6664, 0x1166, 0x6662, 0x2814, 0x4444, 0x6642,
+    0x0801, 0x4441, 0x2001, 0x4221, 0x1221, 0x2222, 0x2221, 0x2221, 0x1114, 0x0001, 0x1111, 0x0801, 0x1114, 0x4444, 0x8139, 0x0001,
+    0x1444, 0x4555, 0x1444, 0x4355, 0x4444, 0x4344, 0x0001, 0x4443, 0x3333, 0x2001, 0x509e, 0x111f, 0x5555, 0x5665, 0x200b, 0x4090,
+    0x5577, 0x2801, 0x5554, 0x4444, 0x5557, 0x7664, 0x5557, 0x7666, 0x2001, 0x5555, 0x5666, 0x0001, 0x4666, 0x6677, 0x4446, 0x6666,
+    0x73b3, 0x6444, 0x0801, 0x3000, 0x10b3, 0x6666, 0x7777, 0x0801, 0x2800, 0x0839, 0x7555, 0x1013, 0x1001, 0x6677, 0x7777, 0x0001,
+    0x104b, 0x2ef5, 0x5557, 0x7777, 0x0001, 0x5777, 0x0801, 0x1000, 0x08d9, 0x4466, 0x0048, 0x0001, 0x00fc, 0x0001, 0x7544, 0x0801,
+    0x4466, 0x0872, 0xfa48, 0x08e6, 0x0001, 0x1134, 0x008d, 0x208f, 0x5773, 0x0001, 0x5447, 0x7333, 0x0001, 0x3444, 0x4333, 0x0001,
+    0x5555, 0x5551, 0x5445, 0x19a6, 0x5115, 0x3445, 0x5555, 0x0001, 0x115b, 0x3334, 0x4555, 0x0001, 0x181f, 0x5566, 0x0001, 0x5566,
+    0x6666, 0x3001, 0x2800, 0x2266, 0x9221, 0x0001, 0x2222, 0x6666, 0x0001, 0x6666, 0x6555, 0x389a, 0x6666, 0x6222, 0x2666, 0x0001,
+    0x5555, 0x5755, 0x6555, 0x5577, 0x1001, 0x2634, 0x6665, 0x5555, 0x0001, 0x6666, 0x6655, 0x0001, 0x083d, 0x5551, 0x5555, 0x5111,
+    0x0801, 0x1000, 0x5115, 0x0001, 0x5111, 0x1771, 0x0907, 0x1117, 0x7777, 0x1555, 0x5777, 0x0001, 0x5555, 0x5556, 0x2001, 0x1777,
+    0x6666, 0x7776, 0x6666, 0x7666, 0x0801, 0x7800, 0x083b, 0x81da, 0x1001, 0x6655, 0x5664, 0x5556, 0x6444, 0x5566, 0x6664, 0x0801,
+    0x0005, 0x1801, 0x4444, 0x01f1, 0x0001, 0x4556, 0x0001, 0x4446, 0x4d4f, 0x6556, 0x0001, 0x4445, 0x5666, 0x0001, 0x113a, 0x6655,
+    0x3001, 0x5555, 0x086e, 0x7777, 0x7755, 0x00f4, 0x0002, 0x2001, 0x000c, 0x824e, 0x000f, 0x5556, 0x7222, 0x2666, 0x7772, 0x2222,
+    0x0001, 0x7777, 0x7222, 0x0001, 0x5777, 0x7772, 0x0001, 0x00af, 0x0097, 0x2555, 0x924b, 0x0801, 0x2225, 0x5666, 0x0001, 0x2222,
+    0x2666, 0x0001, 0x6655, 0x7777, 0x0001, 0x6677, 0x5577, 0x0001, 0x7766, 0x0801, 0x112f, 0x9295, 0x12a2, 0x7722, 0x2255, 0x0001,
+    0x7777, 0x2225, 0x0801, 0x5522, 0x0001, 0x5666, 0x6666, 0x2001, 0x5556, 0x0801, 0x2556, 0x0801, 0x2564, 0x6557, 0x7277, 0x0001,
+    0x6665, 0x5111, 0x0801, 0x5211, 0x0801, 0x5622, 0x0001, 0x1063, 0x2277, 0x7777, 0x0001, 0x2222, 0x2211, 0xfd27, 0x0001, 0x02ac,
+    0x0001, 0x124b, 0x091a, 0x0119, 0x7776, 0x0001, 0x1122, 0x1225, 0x0001, 0x4663, 0x3664, 0x0001, 0x39ab, 0x09cf, 0x26d4, 0x4444,
+    0x4466, 0x0001, 0x6446, 0x6666, 0x0001, 0x3800, 0x4444, 0x0801, 0x2807, 0x6644, 0x1001, 0x4335, 0x0001, 0x4444, 0x4443, 0xea7e,
+    0x0801, 0x2800, 0x1136, 0x3555, 0x0801, 0x4445, 0x0801, 0x4444, 0x4555, 0x0001, 0x118b, 0x5243, 0x3127, 0x180c, 0x1100, 0x5554,
+    0xa79c, 0x2801, 0x5444, 0x2001, 0x4554, 0x4444, 0x0001, 0x0802, 0x0804, 0x6000, 0x4488, 0x8888, 0x2001, 0x0108, 0x0001, 0x4455,
+    0x5511, 0x9249, 0x0001, 0x4444, 0x5551, 0x0001, 0x8888, 0x8889, 0x0001, 0x5222, 0x2555, 0x0001, 0x1222, 0x2222, 0x0001, 0x1112,
+    0x2224, 0x0001, 0x24df, 0x9111, 0x1444, 0x0001, 0x5554, 0x4311, 0x0001, 0x2554, 0x4333, 0x0001, 0x12bb, 0x4333, 0x0801, 0x1393,
+    0x1b08, 0x1b0c, 0x0801, 0x4e00, 0x4444, 0x0001, 0x3344, 0x4554, 0x0001, 0x124e, 0x12cf, 0x292a, 0x4334, 0x4445, 0x0001, 0x4444,
+    0x0800, 0x5555, 0x5444, 0x0001, 0x5554, 0x4444, 0x0001, 0x5555, 0x0800, 0x4555, 0x0801, 0x4445, 0xb525, 0x1001, 0x5599, 0x0001,
+    0x100f, 0x5577, 0x1001, 0x7755, 0x0001, 0x9999, 0x9977, 0x0001, 0x5577, 0x7777, 0x0001, 0x5557, 0x0801, 0x2494, 0x5575, 0x5555,
+    0x0001, 0x5557, 0x7555, 0x0001, 0x7775, 0x5555, 0x2001, 0x5775, 0x5777, 0x0801, 0x5557, 0x0001, 0x5755, 0x5555, 0xa4b2, 0x2001,
+    0x7555, 0x2801, 0x5555, 0x5333, 0x0001, 0x5553, 0x3333, 0x0001, 0x5333, 0x0801, 0x5000, 0x3336, 0x6331, 0x0001, 0x3663, 0x4a4a,
+    0x3333, 0x0001, 0x1111, 0x4444, 0x0001, 0x1133, 0x0801, 0x1144, 0x4433, 0x0001, 0x4444, 0x3333, 0x0801, 0x4411, 0x0001, 0x4433,
+    0x4a49, 0x4442, 0x0001, 0x3333, 0x4446, 0x0801, 0x4464, 0x0001, 0x1444, 0x4444, 0x0001, 0x2444, 0x4333, 0x0001, 0x6443, 0x3333,
+    0x0001, 0x5a59, 0x4443, 0x0801, 0x4333, 0x0801, 0x3800, 0x3344, 0x0001, 0x3355, 0x5555, 0x0001, 0x4455, 0x2801, 0x30ab, 0x5555,
+    0x7557, 0x0801, 0x5526, 0x7777, 0x0801, 0x5777, 0x0801, 0x5666, 0x0001, 0x7555, 0x4801, 0x6666, 0x7766, 0x0001, 0x5555, 0x6655,
+    0x0801, 0x2800, 0x6666, 0x4e59, 0x6665, 0x0001, 0x5566, 0x6555, 0x0001, 0x10cf, 0x1000, 0x5556, 0x6665, 0x0801, 0x6555, 0x0001,
+    0x301f, 0x5544, 0x4455, 0x0001, 0x24d2, 0x5533, 0x3333, 0x2001, 0x5333, 0x3344, 0x0001, 0x5544, 0x3333, 0x0001, 0x1000, 0x4433,
+    0x2801, 0x3444, 0x4443, 0x0801, 0x4444, 0x9493, 0x0001, 0x3334, 0x4445, 0x0801, 0x4555, 0x0001, 0x3335, 0x5555, 0x0001, 0x4335,
+    0x5556, 0x0001, 0x5335, 0x5666, 0x0001, 0x185f, 0x5592, 0x2222, 0x0001, 0x6622, 0x0801, 0x6666, 0x1000, 0x6611, 0x0001, 0x100c,
+    0x6666, 0x1112, 0x0001, 0x2211, 0x1126, 0x0001, 0x1111, 0x4b25, 0x2256, 0x0001, 0x2226, 0x6666, 0x0001, 0x2666, 0x0801, 0x1000,
+    0x6665, 0x5662, 0x0001, 0x6666, 0x6655, 0x2801, 0x6555, 0x0001, 0x4964, 0x2666, 0x0801, 0x5555, 0x5566, 0x0001, 0x5566, 0x6611,
+    0x0801, 0x6666, 0x0001, 0x1000, 0x1111, 0x1115, 0x0001, 0x1166, 0x5555, 0xb9fc, 0x0001, 0x6666, 0x0801, 0x1800, 0x08df, 0x5556,
+    0x6666, 0x2001, 0x00dc, 0x0001, 0x7800, 0x1029, 0x283c, 0x1056, 0x6664, 0x4444, 0x9249, 0x0001, 0x6644, 0x4665, 0x0001, 0x6666,
+    0x6556, 0x0001, 0x6665, 0x5555, 0x0001, 0x4556, 0x6666, 0x0001, 0x5666, 0x6665, 0x0001, 0xfca4, 0x0068, 0x20f2, 0x1807, 0x19f0,
+    0x1148, 0x0000, 0x2277, 0x7777, 0x0001, 0x2222, 0x0801, 0x7722, 0x2277, 0x0001, 0x5555, 0x2222, 0xa524, 0x0001, 0x7777, 0x0800,
+    0x7772, 0x2777, 0x0801, 0x2222, 0x0001, 0x7777, 0x7222, 0x0001, 0x7772, 0x2556, 0x0001, 0x7777, 0x7776, 0x93fe, 0x0001, 0x2227,
+    0x7777, 0x0001, 0x2222, 0x2227, 0x0001, 0x0175, 0x0a28, 0x3230, 0x022a, 0x0023, 0x0810, 0x0001, 0x1800, 0x5555, 0x9e06, 0x0001,
+    0x2222, 0x2252, 0x00a5, 0x10b1, 0x1801, 0x0800, 0x2222, 0x2557, 0x6665, 0x5522, 0x6666, 0x6566, 0x0801, 0x08ed, 0x5666, 0x40f3,
+    0x6655, 0x0001, 0x7775, 0x5655, 0x2222, 0x7766, 0x2222, 0x2266, 0x0001, 0x10b5, 0x08f8, 0x0821, 0x5522, 0x2777, 0x3189, 0x1800,
+    0x2fb5, 0x5557, 0x7775, 0x203b, 0x5554, 0x2001, 0x008b, 0x00d5, 0x10d1, 0x1800, 0x4466, 0x0001, 0x000f, 0x6644, 0x0007, 0x6666,
+    0x2001, 0xce16, 0x1000, 0x000f, 0x4466, 0x6444, 0x0020, 0x0801, 0x2800, 0x7799, 0x9999, 0x4444, 0x4555, 0x102a, 0x6554, 0x0801,
+    0x10e9, 0x9999, 0x524f, 0x999b, 0x0aed, 0x6666, 0x0001, 0x4566, 0x6655, 0x0001, 0x55bb, 0xaa55, 0x0001, 0xbbbb, 0xaaaa, 0x192f,
+    0x0001, 0x1138, 0x0880, 0x330a, 0xaa99, 0x9999, 0x1313, 0x0001, 0x5556, 0x6554, 0x0001, 0x10a3, 0xa555, 0x5555, 0x4444, 0x4448,
+    0x1801, 0x4888, 0x0001, 0x5554, 0x4149, 0x4448, 0x0001, 0x5555, 0x555a, 0x8844, 0x4444, 0x8888, 0x3000, 0x8844, 0x0001, 0xaaaa,
+    0xaabb, 0x0006, 0x4444, 0x888a, 0x0001, 0x2612, 0x8844, 0x44ab, 0x0001, 0xaabb, 0xbbbb, 0x0001, 0x0000, 0x899a, 0xaaa3, 0xabba,
+    0xa443, 0x0001, 0xbbb4, 0x4444, 0x0001, 0xb444, 0xef7e, 0x0801, 0x000f, 0x0a3a, 0x3444, 0x0001, 0x0885, 0x1887, 0x080f, 0x4444,
+    0x1ab9, 0x0377, 0x18c2, 0x000f, 0x0817, 0x038f, 0x4445, 0x2d9e, 0x44aa, 0xaaaa, 0x0001, 0xaaaa, 0x008c, 0x000e, 0xbbba, 0x0b91,
+    0x08e7, 0xaaa4, 0x4444, 0x0001, 0x103f, 0x0005, 0x0391, 0x4449, 0x5739, 0x9999, 0x0001, 0x4444, 0x1001, 0x4499, 0x0801, 0x0006,
+    0x1800, 0x9955, 0x5555, 0x2001, 0x0161, 0x0121, 0x9959, 0x9557, 0x0001, 0x249a, 0x5555, 0x5aa5, 0x0001, 0x555a, 0xaaa5, 0x0001,
+    0x55aa, 0xaaaa, 0x0399, 0x7777, 0x7775, 0x0001, 0x313e, 0xaaa5, 0x514b, 0x55aa, 0x8000, 0x1001, 0x5240, 0x5555, 0x0000, 0x5533,
+    0x0001, 0xaa55, 0x3333, 0x0001, 0xaa33, 0x3355, 0x0001, 0xbb55, 0x5555, 0x3333, 0x3336, 0x3333, 0x3555, 0x940a, 0x0001, 0x3335,
+    0x5999, 0x0001, 0x5aa5, 0x0801, 0xaaa5, 0x5999, 0x6334, 0x4333, 0x5444, 0x4444, 0x0001, 0x9444, 0x0801, 0x9554, 0x8681, 0x1001,
+    0x4443, 0x4444, 0x3333, 0x4433, 0x0801, 0x1000, 0x3355, 0x0801, 0x5555, 0x5566, 0x3344, 0x4464, 0x4444, 0x6664, 0x0801, 0x4819,
+    0x6663, 0x0001, 0x4466, 0x6643, 0x0001, 0x6666, 0x4433, 0x4333, 0x3333, 0x4334, 0x4333, 0x0001, 0x101f, 0x3334, 0x4443, 0x0801,
+    0xde1c, 0x0009, 0x0024, 0x3455, 0x0001, 0x0007, 0x0809, 0x1800, 0x5544, 0x7777, 0x3333, 0x5577, 0x2801, 0x006b, 0x0001, 0x4455,
+    0x5555, 0x120a, 0x5777, 0x5555, 0x5776, 0x0001, 0x7777, 0x6666, 0x2001, 0x5577, 0x7779, 0x7777, 0x7666, 0x6777, 0x2801, 0x6666,
+    0x0800, 0x9996, 0x14d2, 0x6667, 0x6666, 0x5555, 0x3001, 0x6667, 0x0801, 0x7667, 0x7755, 0x08af, 0x5000, 0x6644, 0x2006, 0x5554,
+    0x4444, 0x0001, 0x4444, 0x409c, 0x4664, 0x0001, 0x4466, 0x6444, 0x5555, 0x5553, 0x5554, 0x4333, 0x0001, 0x4663, 0x3334, 0x0001,
+    0x0010, 0x0000, 0x4445, 0x5444, 0x0e12, 0x3333, 0x3377, 0x3344, 0x4433, 0x0001, 0x00b5, 0x20b7, 0x4433, 0x3366, 0x3333, 0x3344,
+    0x080a, 0x4444, 0x3377, 0x0801, 0x6644, 0xc9c5, 0x0801, 0x00af, 0x3335, 0x5555, 0x1001, 0x3555, 0x5552, 0x0801, 0x0005, 0x104a,
+    0x5225, 0x5222, 0x2225, 0x0001, 0x2222, 0x0800, 0x20a6, 0x5555, 0x5552, 0x0001, 0x5552, 0x2111, 0x6666, 0x1111, 0x5522, 0x0801,
+    0x2211, 0x0801, 0x1111, 0x5511, 0x0001, 0x001e, 0x1122, 0x1a09, 0x5556, 0x2266, 0x1111, 0x0001, 0x1800, 0x1115, 0x0801, 0x1155,
+    0x6221, 0x1116, 0x1111, 0x1666, 0x0001, 0x1666, 0x6555, 0x0001, 0x9a76, 0x2089, 0x6666, 0x6555, 0x0008, 0x080a, 0x5566, 0x0001,
+    0x5556, 0x6666, 0x1001, 0x0000, 0x1015, 0x6655, 0x2801, 0x0817, 0x5556, 0x26bb, 0x5555, 0x5666, 0x0001, 0x5566, 0x6666, 0x2001,
+    0x7800, 0x6665, 0x2806, 0x5555, 0x0001, 0x1847, 0x0033, 0x6666, 0x1001, 0x40f0, 0xca40, 0x0843, 0x0800, 0x5599, 0x9555, 0x0001,
+    0x9999, 0x1801, 0x5555, 0x5557, 0x510e, 0x5995, 0x5555, 0x7555, 0x5555, 0x5277, 0x7755, 0x9629, 0x0001, 0x5522, 0x7777, 0x0001,
+    0x5555, 0x00c1, 0x0001, 0x7722, 0x5555, 0x7777, 0x1800, 0x2277, 0x0001, 0x2277, 0x2222, 0x0001, 0x94c4, 0x0000, 0x7777, 0x7772,
+    0x180f, 0x7557, 0x0001, 0x2777, 0x7777, 0x0001, 0x0810, 0x2777, 0x7225, 0x5557, 0x0001, 0x7775, 0x5555, 0xd978, 0x0801, 0x0005,
+    0x5557, 0x0011, 0x0012, 0x5577, 0x7722, 0x0801, 0x7777, 0x0001, 0x0039, 0x0801, 0x0032, 0x2252, 0x2255, 0x2222, 0xd2c4, 0x0001,
+    0x184a, 0x2255, 0x1001, 0x2222, 0x2557, 0x191b, 0x5222, 0x0801, 0x1800, 0x7775, 0x5655, 0x2555, 0x0801, 0x2225, 0x5555, 0xd37c,
+    0x0001, 0x1800, 0x5999, 0x0002, 0x7755, 0x5577, 0x0001, 0x083e, 0x5577, 0x1804, 0x0041, 0x009f, 0x0847, 0x1000, 0x7788, 0x8888,
+    0xdbb5, 0x0001, 0x187d, 0x7778, 0x0801, 0x0800, 0x8888, 0x0800, 0x088f, 0x0007, 0x8877, 0x0001, 0x380f, 0x1111, 0x0808, 0x7799,
+    0x0801, 0xe530, 0x100f, 0x0817, 0x0164, 0x7799, 0x9999, 0x1800, 0x9aaa, 0x0001, 0x7777, 0x7888, 0x0001, 0x000f, 0x9999, 0x999b,
+    0x999b, 0xbbbb, 0x9934, 0x0001, 0xaaaa, 0xaaab, 0x0001, 0x102f, 0x1112, 0x2221, 0x000a, 0xbbbb, 0xbbaa, 0x0801, 0x0005, 0xaaaa,
+    0x100f, 0x1122, 0x2222, 0x0c1c, 0xaa99, 0x9999, 0xaabb, 0xbbaa, 0x0001, 0x300f, 0x2222, 0x2211, 0xa555, 0x5555, 0xaaaa, 0x2800,
+    0x100f, 0x003f, 0x5555, 0x555a, 0xc3f7, 0x103b, 0x380f, 0x1112, 0xaaaa, 0xaabb, 0xbbbb, 0x0800, 0x300f, 0x008f, 0x100d, 0x080f,
+    0x105f, 0x88aa, 0x0001, 0x008f, 0x200f, 0xaecb, 0x1000, 0xaaab, 0x0801, 0x1222, 0x281f, 0x1800, 0x0877, 0x2221, 0x481f, 0x205f,
+    0xbbbb, 0xbbba, 0x181a, 0xaaaa, 0x0001, 0x204f, 0x2b2a, 0xaaa4, 0x4444, 0x0811, 0xbbba, 0x385f, 0x2ddd, 0x0293, 0x508f, 0xdddd,
+    0xdddd, 0x02d0, 0xaaaa, 0x1001, 0x77aa, 0x0001, 0x8877, 0xc3d4, 0x0801, 0x00f5, 0x55aa, 0xaaaa, 0x55aa, 0xabba, 0x0001, 0x0094,
+    0x1896, 0x0800, 0xaaa5, 0x001b, 0xa555, 0x0001, 0xbaaa, 0xaaaa, 0xc3be, 0x2001, 0x000f, 0x5555, 0x55aa, 0x5aaa, 0xaabb, 0x0001,
+    0x1800, 0x1023, 0xbbaa, 0x03b1, 0x106b, 0x1102, 0x20b8, 0x03b1, 0xaaaa, 0x4c92, 0xa999, 0x2001, 0xaaa9, 0x9999, 0x1001, 0x03b1,
+    0x9555, 0x5553, 0x0001, 0x9553, 0x3339, 0x0001, 0x9333, 0x3669, 0x0001, 0x9999, 0x4920, 0x999a, 0x0281, 0x7755, 0xaa66, 0x0001,
+    0x99aa, 0xbb66, 0x0001, 0xaabb, 0xbb77, 0x0001, 0xbbbb, 0x9999, 0x0920, 0x6666, 0x4433, 0x6633, 0x3344, 0x0001, 0x7733, 0x4444,
+    0x0001, 0x3333, 0x3344, 0x0001, 0x9999, 0x5533, 0x3334, 0x4333, 0x4773, 0x4890, 0x3333, 0x2001, 0x4777, 0x7334, 0x0001, 0x3333,
+    0x3334, 0x3333, 0x3800, 0x4999, 0x9333, 0x0801, 0x9933, 0x3333, 0x4455, 0x3333, 0x7094, 0x3355, 0x0801, 0x082b, 0x2015, 0x5577,
+    0x7779, 0x5577, 0x7776, 0x0001, 0x5555, 0x5557, 0x0001, 0x4455, 0x0801, 0x3355, 0x5555, 0x0920, 0x9996, 0x6667, 0x6999, 0x9666,
+    0x0001, 0x7999, 0x9996, 0x0001, 0x7779, 0x999a, 0x0001, 0x5779, 0x9999, 0x7667, 0x7755, 0x6667, 0x5419, 0x7766, 0x0001, 0x6666,
+    0x0800, 0xaaa9, 0x0801, 0x9aaa, 0xaaaa, 0x5555, 0x6644, 0x5555, 0x0800, 0x100f, 0x6666, 0x7799, 0x0001, 0x0320, 0xaa99, 0x99bb,
+    0x4466, 0x6444, 0x5554, 0x4444, 0x0001, 0x1013, 0x6699, 0x9555, 0x0001, 0x99aa, 0xa995, 0x4445, 0x5444, 0x4554, 0x4905, 0x4444,
+    0x0001, 0x5444, 0x4447, 0x0001, 0x5555, 0x5554, 0x0801, 0x5776, 0x4433, 0x3366, 0x4333, 0x6666, 0x0001, 0x7466, 0x0801, 0x494d,
+    0x4666, 0x0801, 0x6666, 0x5566, 0x00af, 0x6666, 0x4444, 0x0001, 0x6644, 0x0801, 0x4444, 0x4455, 0x0801, 0x1039, 0x5221, 0x0001,
+    0x384d, 0x5222, 0x2111, 0x0001, 0x1043, 0x0000, 0x5552, 0x2111, 0x1111, 0x1115, 0x0001, 0x1225, 0x5555, 0x0001, 0x3800, 0x2211,
+    0x0001, 0x261a, 0x5511, 0x1111, 0x0001, 0x2222, 0x5555, 0x0001, 0x0000, 0x1111, 0x1155, 0x1155, 0x5511, 0x0001, 0x381b, 0x6666,
+    0x0811, 0x1555, 0x9295, 0x0001, 0x5555, 0x5666, 0x0001, 0x5556, 0x6666, 0x0001, 0x6556, 0x0803, 0x5666, 0x6655, 0x0001, 0x6666,
+    0x1001, 0x6555, 0x0001, 0x0ac4, 0x6aaa, 0xaccc, 0x5555, 0x5566, 0x1801, 0x55cc, 0x0001, 0xcccc, 0x1800, 0x18b9, 0x6666, 0xcccc,
+    0x6ccc, 0x0001, 0xcc66, 0xcccc, 0xc752, 0x0001, 0x080f, 0x6665, 0x6555, 0x5555, 0x0001, 0x201b, 0x0800, 0xc555, 0x2056, 0xcccc,
+    0x0801, 0xccc5, 0x5599, 0x0001, 0x5559, 0x5241, 0x99aa, 0x080c, 0x5599, 0x0001, 0x99bb, 0x9999, 0x0001, 0xbbbb, 0xaa99, 0x0801,
+    0xbb55, 0x9999, 0x9555, 0x9995, 0x5555, 0x2001, 0x2148, 0x5555, 0x5559, 0x1001, 0x5995, 0x5555, 0x5999, 0x9555, 0x0001, 0x5aa9,
+    0x0801, 0x9aa9, 0x9995, 0x1001, 0x5555, 0x7722, 0x5555, 0x6164, 0x5577, 0x0801, 0x3800, 0x2222, 0x2222, 0x7722, 0x2266, 0x0001,
+    0x5522, 0x0801, 0x300f, 0x2222, 0x2772, 0x0001, 0x6227, 0x7777, 0x9024, 0x0001, 0x6662, 0x2777, 0x0001, 0x6666, 0x6777, 0x2777,
+    0x7777, 0x2227, 0x7775, 0x0001, 0x7222, 0x2225, 0x2001, 0x7772, 0x2555, 0x324e, 0x5555, 0x5522, 0x2801, 0x2800, 0x7722, 0x2255,
+    0x0001, 0x2222, 0x2225, 0x0001, 0x5555, 0x5545, 0x0801, 0x1000, 0x1075, 0x5999, 0xede4, 0x0801, 0x1007, 0x0800, 0x9555, 0x2801,
+    0x1891, 0x5ddd, 0x0801, 0x007f, 0x0001, 0x283f, 0x66dd, 0xdddd, 0x0001, 0x2222, 0x2227, 0xa5ec, 0x0001, 0x7777, 0x0800, 0x77dd,
+    0xddd6, 0x0001, 0xdddd, 0x0800, 0x100b, 0x1000, 0x1105, 0xd666, 0x0801, 0x100b, 0x7ddd, 0xdddd, 0xe7bb, 0x0001, 0x2117, 0x0000,
+    0x77dd, 0xdddd, 0x0001, 0x1000, 0x300f, 0x100b, 0xdd9d, 0x0801, 0x500f, 0x1000, 0x666d, 0x0801, 0x0944, 0x199b, 0xcccc, 0xd777,
+    0xdd77, 0x0001, 0x3013, 0xccdd, 0xdd66, 0x0001, 0x104f, 0xdddd, 0x7722, 0x0801, 0x1043, 0x66dd, 0x0001, 0x100f, 0x249c, 0x2227,
+    0x777d, 0x0001, 0xd777, 0x7777, 0x0001, 0x7777, 0x7eee, 0x0001, 0x777d, 0xdddd, 0x0001, 0x1000, 0x1073, 0xe777, 0x7777, 0xbd2c,
+    0x0001, 0xdddd, 0x003d, 0x383f, 0x309f, 0x580f, 0x7222, 0x0001, 0xddd7, 0x7777, 0x2801, 0x7eee, 0x0001, 0x093f, 0x2222, 0x7222,
+    0x4e6e, 0x2777, 0x0001, 0x7eee, 0xeeee, 0x0001, 0x1000, 0x3033, 0xeeee, 0xee77, 0x0801, 0x100f, 0xd777, 0x0001, 0x0040, 0x0801,
+    0x7ddd, 0xb7d3, 0x0001, 0xeeee, 0x0015, 0x0018, 0x777d, 0x0001, 0x585b, 0x486f, 0x1083, 0x1813, 0xaa77, 0x0001, 0xaaaa, 0xaadd,
+    0x0801, 0x0800, 0x2495, 0x77ab, 0xbbbb, 0x0001, 0xaaab, 0xbaaa, 0x0001, 0xaaaa, 0xaaab, 0x0001, 0x777b, 0xbbbb, 0x0001, 0xbaab,
+    0x0801, 0xaaab, 0x0801, 0x2925, 0xbbbb, 0xbaaa, 0x0801, 0xbbba, 0x0001, 0xbbaa, 0xbbbb, 0x0001, 0xbabb, 0xaabb, 0x0001, 0xabbb,
+    0xaaaa, 0x0001, 0xaabb, 0x0801, 0x9e6d, 0x1000, 0xaa99, 0x99aa, 0x0001, 0x0004, 0x0001, 0x100f, 0xa999, 0x9999, 0x2001, 0x3800,
+    0x9aab, 0x0801, 0x2800, 0x9aa9, 0x0801, 0xaa73, 0x083e, 0xbbaa, 0x1000, 0x9999, 0x1001, 0x99aa, 0x0001, 0xaabb, 0x9999, 0x0001,
+    0x005c, 0x0000, 0xaabb, 0xbbba, 0x0801, 0x083f, 0x2493, 0x9999, 0x9339, 0x0001, 0xb999, 0x999a, 0x0001, 0xa999, 0x9aaa, 0x0001,
+    0xa99a, 0xaaab, 0x0001, 0x9999, 0x9b99, 0x0001, 0x107f, 0xcf00, 0x1883, 0x0800, 0x3333, 0xbb33, 0x0001, 0x0030, 0x1832, 0x1800,
+    0x2924, 0x3333, 0x5555, 0x0801, 0x3555, 0x0001, 0x9988, 0x8885, 0x0001, 0xbbaa, 0xaaaa, 0x0001, 0x5557, 0x7999, 0x0001, 0x5555,
+    0x5779, 0xd294, 0x0801, 0x0800, 0xaaa5, 0x0801, 0x9999, 0xaaaa, 0x0801, 0xaa99, 0x0001, 0x5999, 0x9999, 0x0001, 0x5559, 0x0801,
+    0xaaaa, 0xbbbb, 0x9924, 0x2001, 0x99aa, 0xaabb, 0x0001, 0x101b, 0x99ba, 0xaaa9, 0x0001, 0xbbbb, 0xbaaa, 0x2001, 0xaaba, 0xaaa9,
+    0x0001, 0x9995, 0x5666, 0x9d39, 0x0001, 0xa999, 0x9666, 0x0001, 0x0008, 0x0001, 0x9999, 0x0800, 0x6655, 0x5566, 0x2001, 0x104f,
+    0x100f, 0x6666, 0x6644, 0x2801, 0x4b24, 0x6655, 0x0001, 0x9966, 0x5555, 0x0001, 0x4555, 0x2801, 0x1000, 0x555c, 0xcccc, 0x0001,
+    0x5557, 0x7666, 0x0001, 0x5666, 0x6665, 0xd274, 0x0001, 0x100f, 0xcccc, 0x0800, 0x6655, 0x5555, 0x0001, 0x5555, 0x5577, 0x0801,
+    0x280f, 0x184c, 0x665b, 0x0001, 0x5555, 0x55bb, 0x92a4, 0x0001, 0xcccc, 0xccba, 0x0001, 0x5aaa, 0xabba, 0x0001, 0xbbbb, 0x0800,
+    0xbaab, 0x0800, 0xaaa9, 0x9999, 0x0001, 0xaaaa, 0xaacc, 0x9267, 0x0001, 0xbaaa, 0xa999, 0x0001, 0xb999, 0x9999, 0x0001, 0x9999,
+    0x99cc, 0x0001, 0x1033, 0x9999, 0x66cc, 0x0001, 0x106f, 0x100b, 0x2492, 0xcccc, 0xc555, 0x0001, 0x6666, 0x6bb9, 0x0001, 0x5555,
+    0xbbba, 0x0001, 0xbbcc, 0xbbbb, 0x0001, 0x555b, 0xb555, 0x0001, 0x9bbb, 0x4c9c, 0xb999, 0x0001, 0xabbb, 0xbbbb, 0x0001, 0x1000,
+    0x599b, 0xaaaa, 0x0001, 0x9aab, 0xbbbb, 0x0001, 0x1800, 0x08e8, 0xbbaa, 0x9999, 0xd493, 0x0801, 0x0917, 0xbbaa, 0x0800, 0xbbbb,
+    0x0801, 0x9995, 0x555a, 0x0001, 0xaa9b, 0xb999, 0x0001, 0xaabb, 0xbbb9, 0x0001, 0x1822, 0x4a4b, 0xa999, 0x0001, 0x9aaa, 0xaaa9,
+    0x0801, 0xabb5, 0x0001, 0xbaab, 0xbbba, 0x0001, 0x9555, 0x5555, 0x0001, 0x9955, 0x0801, 0x1000, 0x2492, 0xa999, 0x9955, 0x0001,
+    0x2222, 0x2227, 0x0001, 0x7772, 0x2222, 0x0001, 0x5777, 0x7444, 0x0001, 0x5557, 0x7774, 0x0001, 0x7775, 0x535c, 0x5555, 0x0001,
+    0x2225, 0x0801, 0x4444, 0x4555, 0x2001, 0x1027, 0x7777, 0x0800, 0x5577, 0x0801, 0x0008, 0x20e7, 0x5555, 0x5557, 0x96c0, 0x0001,
+    0x7755, 0x7777, 0x1001, 0x77ee, 0x0011, 0x0800, 0x7555, 0x0801, 0x1037, 0x7777, 0x7775, 0x7777, 0x777d, 0x5555, 0x5d66, 0xa850,
+    0x0801, 0x57dd, 0x0801, 0x5ddd, 0x0801, 0x57dd, 0xddd6, 0x66dd, 0xdddd, 0x6000, 0x6666, 0x600e, 0xee44, 0x4ee6, 0xdddd, 0xd666,
+    0xede6, 0x0801, 0x401e, 0x1800, 0xd666, 0x3801, 0x2800, 0x66dd, 0x0801, 0x083a, 0x004c, 0x000a, 0x666c, 0xcccc, 0x0001, 0x402f,
+    0x666d, 0x1f35, 0xdddd, 0xcccc, 0xc777, 0x0001, 0x5051, 0x10ab, 0x380c, 0x0830, 0x77ee, 0xeeee, 0x0001, 0x1843, 0xcccc, 0x0001,
+    0xdd66, 0x0165, 0x3092, 0x66cc, 0xeeee, 0x0800, 0x301e, 0x6ddd, 0xdddd, 0xccc7, 0x7777, 0x100f, 0xdccd, 0xdccc, 0x0001, 0xdccc,
+    0xc777, 0x0001, 0xdddd, 0x04ce, 0xd777, 0x7ee4, 0x4eee, 0xee77, 0x7777, 0x0001, 0xcccc, 0xcc77, 0x0001, 0x184b, 0xdddd, 0xeeee,
+    0x104e, 0x1800, 0x285d, 0x77dd, 0xb40c, 0x180c, 0x777d, 0x0001, 0x2842, 0xddd7, 0x506f, 0xd777, 0x7777, 0x777e, 0xeeee, 0x8888,
+    0x88ee, 0x0001, 0x0838, 0x7777, 0xdd77, 0x4c95, 0x7744, 0x0001, 0x7777, 0x4444, 0x105d, 0x0000, 0x7777, 0x8ccc, 0x0001, 0x4444,
+    0x444c, 0x0001, 0xeeee, 0x000f, 0xe444, 0x100f, 0x2409, 0xccc8, 0x8cc7, 0x0001, 0xc888, 0x8777, 0x0001, 0x488c, 0xccc7, 0x4888,
+    0x888c, 0xeeee, 0xeedd, 0x0001, 0x7dd8, 0x8888, 0x0001, 0x56a4, 0x7777, 0x1001, 0x7777, 0x008f, 0xaaaa, 0x0800, 0x1287, 0x8899,
+    0x0801, 0x7788, 0x0811, 0x777b, 0xbbbb, 0x0001, 0xaa97, 0x7aab, 0x9149, 0x0001, 0x9999, 0x9997, 0x0801, 0x9999, 0x8888, 0x8888,
+    0x12c7, 0xbaab, 0x0801, 0x7aaa, 0xaaaa, 0x0001, 0x9999, 0x9aaa, 0x000f, 0xe1f2, 0x102f, 0x3000, 0x0306, 0x8888, 0x88aa, 0xaabb,
+    0xbbaa, 0x0001, 0x1207, 0x000c, 0x080e, 0x0b00, 0x9999, 0x999a, 0x2001, 0x9cc9, 0x492c, 0x9999, 0x0001, 0x9ccc, 0xccc9, 0x025e,
+    0xaaa9, 0x9aa9, 0x0001, 0xaaaa, 0xaaa9, 0x0001, 0x999a, 0x0801, 0x001c, 0xcccc, 0xccc9, 0xf3e7, 0x106b, 0x0b3e, 0x1b46, 0x1000,
+    0x99aa, 0xaa99, 0x0801, 0x0005, 0x180b, 0x1000, 0x126b, 0x999a, 0xaaab, 0x0001, 0x006b, 0x0801, 0x937b, 0x0800, 0xbbba, 0xabbb,
+    0x0001, 0xbaaa, 0xaaaa, 0x0001, 0x105f, 0x9aa9, 0x080f, 0x1a87, 0x1871, 0x0001, 0xbb99, 0x0871, 0x128b, 0xc6e6, 0x104f, 0x2800,
+    0xcccc, 0xa999, 0x9999, 0x0001, 0x3800, 0x999c, 0x0aeb, 0x4800, 0x000d, 0xccc8, 0x8888, 0x33bf, 0x180f, 0xcc99, 0x2700, 0x8888,
+    0x5555, 0x12af, 0x99a9, 0x9999, 0x0001, 0x2000, 0x025b, 0x4d92, 0x9999, 0x5800, 0x5555, 0x5555, 0x680f, 0x0002, 0xcccc, 0x0801,
+    0x4800, 0xcccc, 0xc888, 0x0001, 0x999c, 0xcccc, 0x0001, 0x9999, 0x6d9c, 0x999c, 0x0801, 0x0800, 0x8888, 0x0800, 0x1013, 0xcccc,
+    0x0800, 0x0011, 0x9ccc, 0xcccc, 0x100f, 0x1813, 0x2800, 0x88cc, 0xcc99, 0x9fa9, 0x0001, 0x8888, 0x888c, 0x0001, 0x300f, 0x1843,
+    0x4800, 0x104b, 0x5800, 0xbbbb, 0x0001, 0x9999, 0x0801, 0xcc99, 0x9999, 0x0001, 0xc924, 0x000c, 0x0047, 0xbbbb, 0xb99b, 0x0001,
+    0xbb99, 0x999a, 0x0001, 0x9999, 0x999b, 0x0001, 0xcccc, 0xccc9, 0x0056, 0xbbba, 0xaaab, 0x9492, 0x0001, 0xaaaa, 0xabbb, 0x0001,
+    0xbbba, 0x0801, 0x9999, 0x9aaa, 0x0021, 0xbbba, 0xaaaa, 0x0001, 0xbaaa, 0x99aa, 0x0001, 0xb999, 0x4534, 0x9999, 0x0001, 0xa999,
+    0x9999, 0xc999, 0x0038, 0xaabb, 0x0001, 0xaaaa, 0xaa99, 0x0001, 0x28ad, 0x9999, 0x080e, 0xbbbb, 0x99bb, 0x52bd, 0xbaaa, 0x0001,
+    0x99ab, 0x0801, 0x999a, 0xaaa9, 0x0011, 0xbbbb, 0x0800, 0xaaaa, 0x0800, 0x002b, 0x0001, 0x1000, 0xbaaa, 0x0801, 0xfca9, 0x002c,
+    0x282e, 0x20f2, 0x2001, 0x290f, 0x3000, 0x9999, 0x9555, 0x0001, 0x9555, 0x1008, 0x5577, 0x3011, 0x55dd, 0xdddd, 0x0001, 0x02cc,
+    0xddee, 0xeeee, 0x77ee, 0x7777, 0x55ee, 0xeee7, 0x0001, 0xeeee, 0x1001, 0x1800, 0x7777, 0x777d, 0x1801, 0x0800, 0xeeee, 0xe777,
+    0x8248, 0x0801, 0xeeee, 0xddd6, 0x66dd, 0xd666, 0x6dee, 0x0001, 0x766e, 0xeeee, 0x0001, 0x7777, 0x7666, 0x0001, 0xeee7, 0x7777,
+    0xdddd, 0x1262, 0x6666, 0xee66, 0xee77, 0x0001, 0xddee, 0x7766, 0x0001, 0xdd77, 0x6666, 0x0001, 0x0025, 0xee44, 0x4ee6, 0x6666,
+    0x0012, 0xdddd, 0x4826, 0x66dd, 0x0801, 0xddff, 0xfffd, 0x0001, 0x44ff, 0xf444, 0x6666, 0x6666, 0xddd6, 0x0801, 0xdddd, 0xddd6,
+    0x0801, 0x0800, 0x444f, 0x6d31, 0xffff, 0x000f, 0x1800, 0xcccc, 0x0001, 0x1017, 0xffff, 0x280f, 0xcccc, 0xdddd, 0x0001, 0x1037,
+    0xff44, 0x44dd, 0x666d, 0x183b, 0xb949, 0x3800, 0xd666, 0x2807, 0x083f, 0x102f, 0x6666, 0x6ccc, 0x0024, 0xd666, 0x0801, 0x6666,
+    0xcc66, 0x0001, 0x6ccc, 0x8866, 0x0001, 0x4773, 0xc888, 0x000e, 0x66cc, 0xcc88, 0x8866, 0x0001, 0x103b, 0x2000, 0xccc7, 0x10aa,
+    0x0095, 0x3800, 0x7ee4, 0x4eee, 0x600f, 0x00b6, 0x99b0, 0x10d5, 0xdd77, 0x7777, 0x0001, 0x200f, 0x7777, 0x77dd, 0x0811, 0x2013,
+    0x77ee, 0x0001, 0x00be, 0xdddd, 0xddd7, 0x7777, 0x777e, 0x9229, 0x0001, 0xeccc, 0xcccc, 0x0001, 0xeeee, 0xeee4, 0x0001, 0x4444,
+    0x4444, 0x777e, 0x1905, 0xccce, 0x0801, 0x444c, 0xc8cc, 0x0001, 0xcc32, 0x000f, 0x2115, 0x44ee, 0xdddd, 0x0001, 0x2217, 0xeeee,
+    0xe444, 0xeedd, 0xddde, 0x0001, 0x1049, 0x8888, 0xd888, 0x0801, 0x8444, 0x093c, 0x4888, 0x888c, 0xe888, 0x8777, 0x0001, 0xdddd,
+    0xd777, 0x0001, 0x8777, 0x7777, 0x0001, 0x00ef, 0x088f, 0x0063, 0xdddd, 0x777d, 0xa733, 0x0801, 0x7ddd, 0x0801, 0xf777, 0x77dd,
+    0x189e, 0x488f, 0x0041, 0x7777, 0x7444, 0x0001, 0x500f, 0x4444, 0x4888, 0x0001, 0x103f, 0x21ed, 0xddd4, 0x4eee, 0x0001, 0xd777,
+    0x777d, 0x8888, 0x88aa, 0x1065, 0x1043, 0x10a7, 0x001f, 0xaaaa, 0x1aa1, 0x18b9, 0xffff, 0x0001, 0xe499, 0x00c5, 0x1253, 0x0000,
+    0xdddc, 0xcccc, 0x0001, 0xffff, 0xfffe, 0x0001, 0x777f, 0xffff, 0x0a53, 0x2ac1, 0xeeee, 0xeeed, 0x0001, 0xdb9e, 0x015f, 0x0ad1,
+    0xaaaa, 0x0801, 0x3033, 0x7777, 0x000f, 0x124d, 0x300f, 0xeeee, 0xeeff, 0x0a14, 0x0af9, 0x300f, 0x102f, 0xcccc, 0x79ec, 0xcc88,
+    0x0001, 0x500f, 0x3301, 0x100f, 0xffee, 0xeeee, 0x001e, 0x230e, 0x0001, 0x183f, 0xeeee, 0x087f, 0x0b0d, 0xcddd, 0xdddd, 0xd62f,
+    0x0001, 0x200f, 0xccc8, 0x0018, 0xcc55, 0x0001, 0x30cd, 0xeee6, 0x6666, 0x8888, 0x1a5b, 0xdd55, 0x0801, 0x100f, 0x01b8, 0x4281,
+    0xa7fe, 0x180f, 0x6777, 0x200b, 0x5ddd, 0xdddd, 0x0001, 0x0178, 0x0001, 0x0000, 0x0aaa, 0x281b, 0x2129, 0x22b3, 0x08fe, 0x200e,
+    0x77dd, 0xedc0, 0x236d, 0x200c, 0x0947, 0xddd7, 0x03a1, 0x1000, 0x7ccc, 0x0801, 0x1163, 0x0011, 0x4a5c, 0xcccc, 0x1800, 0xcc88,
+    0x8888, 0x0001, 0xdddd, 0x0800, 0x77dd, 0xdddd, 0x080c, 0x8888, 0x0001, 0x1000, 0x100f, 0xdddd, 0xddee, 0xc953, 0x080e, 0x2800,
+    0xddd7, 0x7777, 0x0001, 0xe777, 0x7777, 0x280f, 0x88cc, 0x0001, 0x7777, 0x0800, 0x7eee, 0xeeee, 0x200b, 0x1043, 0xb7ca, 0x102e,
+    0xeeee, 0x000f, 0x2050, 0xcccd, 0x0001, 0x200f, 0x200e, 0x184b, 0x180f, 0xc999, 0x9999, 0x600f, 0xcccc, 0x680f, 0x9999, 0xecb1,
+    0x180f, 0x404f, 0x480f, 0xdccc, 0x0001, 0x100f, 0xcc55, 0x5555, 0x0001, 0xcccc, 0x1001, 0x0800, 0xeddd, 0xdddd, 0x5555, 0x3800,
+    0xcb7e, 0x2013, 0x400f, 0x5555, 0x5ddd, 0x0001, 0xc555, 0x0003, 0x3800, 0xd555, 0x0801, 0x08d0, 0x0042, 0x0800, 0x306f, 0x1061,
+    0xeeee, 0x7164, 0xeedd, 0x0001, 0x500f, 0x380a, 0xd666, 0xddd6, 0x6666, 0x0001, 0xeee7, 0x08f5, 0x0001, 0xddd6, 0x6d66, 0x0001,
+    0x6666, 0x6666, 0x3249, 0x6dd6, 0x6eee, 0x0001, 0x00f3, 0x6666, 0x6677, 0x0001, 0x6644, 0x4444, 0x0001, 0xffff, 0xff44, 0x1049,
+    0x44ff, 0xf444, 0x1107, 0x726c, 0xffff, 0x0800, 0x0010, 0x100f, 0x444f, 0xffff, 0x100f, 0xf774, 0x4447, 0x0001, 0x0011, 0xeeef,
+    0x0801, 0x0000, 0x7774, 0x4444, 0xe4d9, 0x0001, 0x3023, 0x0000, 0xff44, 0x44dd, 0x1005, 0x7777, 0x44ff, 0x0001, 0x0831, 0x44ff,
+    0x0001, 0x0065, 0x4444, 0x4666, 0x0001, 0x3424, 0xffff, 0xfff4, 0x0801, 0x0000, 0xf444, 0x0001, 0x6666, 0x6ccc, 0x6666, 0x6888,
+    0x0001, 0x444c, 0xc888, 0x0001, 0xfff4, 0x4444, 0x2243, 0x444c, 0xcccd, 0x0001, 0xc888, 0xdddd, 0x88dd, 0x0801, 0x8777, 0x7777,
+    0x0001, 0x4444, 0x44dd, 0xdd66, 0xcc77, 0x0001, 0x209a, 0x7a38, 0x7777, 0x0801, 0x11ad, 0x0001, 0xd800, 0xd777, 0x0801, 0xdddd,
+    0xdd77, 0x7777, 0x0001, 0x2835, 0x1000, 0xee44, 0x77ee, 0xeecc, 0x9093, 0x0001, 0xdddd, 0x777c, 0x0001, 0x7777, 0x77ee, 0x77ee,
+    0xeeee, 0x0001, 0x4444, 0x4444, 0x1147, 0xccc4, 0x4444, 0x0001, 0x1918, 0xeb26, 0x080f, 0x100b, 0x1000, 0xeee4, 0x0011, 0xee44,
+    0x0001, 0x01de, 0x44cc, 0xcc88, 0x0001, 0x44ee, 0x8888, 0x0001, 0x20af, 0x8888, 0x1692, 0x8444, 0x8888, 0x8884, 0x0801, 0x844f,
+    0x0001, 0x18b1, 0xffff, 0x00ef, 0x4444, 0x4fff, 0x0001, 0xf884, 0x4444, 0x0001, 0x4ff4, 0x424d, 0x4884, 0x100f, 0xf777, 0x77dd,
+    0xfff7, 0xdddd, 0x0001, 0x4444, 0x4477, 0x0001, 0x4fff, 0xff77, 0x100f, 0x4879, 0xcc88, 0x200f, 0x9084, 0x114f, 0x7777, 0x7444,
+    0x0001, 0xeeee, 0xe44e, 0x8884, 0x4444, 0x0001, 0xd777, 0x777d, 0x7777, 0x7ddd, 0x0001, 0x444e, 0xeddd, 0xccf5, 0x0001, 0x007b,
+    0x4888, 0x8888, 0x0001, 0x5189, 0x8888, 0x8844, 0x0001, 0x30bb, 0x100f, 0x1044, 0x777f, 0x0041, 0xddd7, 0x0801, 0x9fe2, 0x180f,
+    0x7ddd, 0xdddd, 0x0001, 0x094b, 0x0800, 0x1013, 0x01a9, 0x1005, 0x1869, 0x2000, 0x6666, 0x7777, 0x7766, 0x0001, 0xeeee, 0x3f33,
+    0xeeff, 0x7777, 0x0037, 0x1839, 0x01bf, 0x1000, 0x002f, 0x10e5, 0x7777, 0x7776, 0x0001, 0x000b, 0x6ddd, 0xdddd, 0x0001, 0x200f,
+    0xdafb, 0x201b, 0x1055, 0xffee, 0x1905, 0x180e, 0x66dd, 0x2a1f, 0xe666, 0x0001, 0x301d, 0x100f, 0x202b, 0x300f, 0xeee6, 0x300e,
+    0x280f, 0xcbef, 0x380e, 0x2810, 0x6666, 0x6777, 0x187b, 0x6777, 0x0001, 0x4909, 0x1800, 0x219f, 0x280c, 0x77dd, 0x0001, 0x00e9,
+    0x2009, 0x30ef, 0x9fcf, 0x000a, 0x7744, 0x4444, 0x0001, 0x20eb, 0x2000, 0x1195, 0x1837, 0x480f, 0x002e, 0xdd66, 0x6666, 0x0001,
+    0x300d, 0x0000, 0x02e0, 0x3593, 0x4444, 0x6666, 0x0001, 0x1000, 0x4477, 0x0231, 0x444d, 0x0001, 0x03b1, 0x6444, 0x4666, 0x0001,
+    0x6666, 0x6667, 0x0001, 0x0839, 0xf800, 0x086f, 0x03b1, 0x00d7, 0x0001, 0x4085, 0x13ad, 0xeeee, 0xeeee, 0xdddd, 0x0800, 0x7777,
+    0x7744, 0x0801, 0x1800, 0x080f, 0x777d, 0x0001, 0x4444, 0x0800, 0x380f, 0xddd6, 0x0001, 0x36ab, 0x444e, 0xeeee, 0x0001, 0x080c,
+    0x777d, 0x0001, 0x000f, 0x6666, 0x0800, 0xeee6, 0x0801, 0x7eee, 0x0019, 0xdd77, 0x0001, 0x080f, 0x72d9, 0x66dd, 0x0801, 0x0800,
+    0x302f, 0xdd66, 0x6666, 0x0001, 0xddd6, 0x0801, 0x0055, 0x77dd, 0x0801, 0x000f, 0x666d, 0xdeee, 0x0001, 0x3be5, 0x6666, 0x6ddd,
+    0x0001, 0x1067, 0x0000, 0xeddd, 0x0011, 0x0801, 0x2004, 0x0076, 0x0001, 0xcccc, 0xcccc, 0x1015, 0xeedd, 0x0801, 0x9dbf, 0x202f,
+    0xc555, 0x5ddd, 0x2027, 0x0800, 0x0077, 0xd666, 0x0801, 0x0000, 0xddde, 0x0801, 0x0800, 0x0040, 0x1001, 0x2819, 0x0001, 0x526b,
+    0xdd64, 0x0801, 0xddd4, 0x0001, 0xd666, 0x666d, 0x0001, 0x666e, 0xeeee, 0x0001, 0x10a1, 0x4eee, 0x0801, 0xdeee, 0x0801, 0xd800,
+    0x6cd2, 0xefff, 0x0801, 0x4800, 0xffff, 0x0800, 0x700f, 0xe444, 0x44ff, 0x0001, 0x180c, 0xeeff, 0x0001, 0xff44, 0x6644, 0x0001,
+    0xffff, 0x6499, 0xff44, 0x0801, 0x2800, 0x444f, 0xf666, 0x0001, 0xee44, 0x4444, 0x0001, 0xfff4, 0x4446, 0x0001, 0x100f, 0x6666,
+    0x666d, 0x0001, 0x2664, 0x444f, 0xfffc, 0x0001, 0x6666, 0x6fff, 0x0001, 0x100f, 0xd6cc, 0xcccc, 0x0001, 0x1000, 0xffff, 0xee44,
+    0x0001, 0xffcc, 0xcccc, 0xf339, 0x0001, 0x10ae, 0x104a, 0x1151, 0xcc66, 0x66ee, 0x0001, 0x30dc, 0x4447, 0x7777, 0x0001, 0x1017,
+    0x100b, 0xd777, 0x7777, 0x0001, 0x3e9e, 0x777e, 0xeeee, 0x0001, 0x1000, 0x2145, 0x1147, 0x2000, 0x77ee, 0x0801, 0x7777, 0x77ee,
+    0x0001, 0x70c6, 0x1083, 0x1007, 0x44ff, 0x7e66, 0xffff, 0x0001, 0x00b4, 0x0001, 0x1807, 0x28bf, 0x3000, 0xeee4, 0x4fff, 0x0001,
+    0x1007, 0xfffc, 0xcccc, 0x0001, 0x3013, 0xff44, 0x4d2d, 0x4488, 0x0001, 0xcccc, 0xccee, 0x0001, 0x180b, 0x4444, 0x0001, 0xee4d,
+    0xdddd, 0x0001, 0x44ed, 0x0801, 0x18a3, 0x4eee, 0x0001, 0x29a7, 0xdddd, 0xd888, 0x0801, 0xddd8, 0x0001, 0xefff, 0xffff, 0x0001,
+    0x112b, 0x8888, 0x0800, 0x88ff, 0xffff, 0x0001, 0x3000, 0x100f, 0xcdb9, 0x5063, 0x500f, 0xfeee, 0xeeee, 0x0001, 0x100f, 0xf888,
+    0x0801, 0x1957, 0xeeef, 0x0001, 0x100f, 0x3000, 0xffff, 0xff88, 0x0001, 0x26ef, 0x7777, 0x7766, 0x0001, 0x8888, 0x7777, 0x0801,
+    0x1000, 0x8887, 0x0001, 0x1219, 0x10ef, 0x8777, 0x0801, 0x1000, 0x110f, 0x0a80, 0xffea, 0x0218, 0x126e, 0x0807, 0x3000, 0x121b,
+    0x7800, 0x121f, 0x2223, 0x0210, 0x0a71, 0x3000, 0xd666, 0x0801, 0x6666, 0x0297, 0xeeee, 0x64e6, 0x6eee, 0x0801, 0x129d, 0xee66,
+    0x7766, 0x0001, 0xee77, 0xdddd, 0x0001, 0x1053, 0x116b, 0xdddd, 0xddd7, 0x0801, 0x2800, 0x7444, 0x7fcf, 0x4444, 0x0001, 0x12fd,
+    0x180c, 0x0acf, 0x11a7, 0x42fd, 0x0000, 0x300f, 0x1000, 0x7444, 0x444f, 0x0001, 0x500f, 0x10e3, 0x0028, 0xeb2c, 0x0801, 0x480f,
+    0x1833, 0x44cc, 0x0801, 0xcccd, 0x0001, 0x100f, 0x7ddd, 0xdddd, 0x0001, 0xcddd, 0x0801, 0x1000, 0xfff4, 0x444d, 0x9b3c, 0x0001,
+    0xddd7, 0x7777, 0x0001, 0x38bf, 0xdccc, 0x0001, 0x30f3, 0xdddd, 0xddcc, 0x0001, 0x1237, 0x301a, 0x100b, 0xcc77, 0x7777, 0xe7ec,
+    0x0001, 0x180c, 0x08af, 0xc777, 0x7777, 0x0001, 0x30bf, 0x1000, 0x1057, 0x30a3, 0x1000, 0xdd77, 0x0801, 0x5000, 0x4444, 0x4fff,
+    0x9f80, 0x0001, 0x7744, 0x4444, 0x0001, 0x314b, 0x1abb, 0x0801, 0x3027, 0x31b3, 0x4a52, 0x7777, 0x2800, 0xee44, 0x4444, 0x0001,
+    0xffff, 0x0801, 0x7777, 0x7666, 0x0801, 0x7774, 0x0001, 0x4ee4, 0x4ee7, 0x0001, 0x444d, 0x5254, 0xdddd, 0x0001, 0x666d, 0x0801,
+    0x4444, 0x444d, 0x0001, 0x7777, 0x7ddd, 0x0001, 0xdddd, 0x3000, 0xffff, 0x0001, 0x4444, 0x4444, 0x6ab4, 0xeeee, 0x1800, 0x180e,
+    0x444d, 0x0801, 0xffff, 0x200f, 0xdeee, 0x2801, 0xfeee, 0x200e, 0x3800, 0xeee4, 0x282f, 0xe4ff, 0xffff, 0xaaec, 0x0001, 0xee44,
+    0x0801, 0x4fff, 0x282f, 0xcc66, 0x0801, 0xccee, 0x0801, 0x0050, 0x2828, 0xe444, 0x0801, 0x4800, 0x444e, 0xee44, 0xd9f9, 0x0001,
+    0x5012, 0x44ee, 0x0801, 0x5000, 0xeeef, 0xffff, 0x0001, 0x500f, 0x0087, 0x0889, 0x1001, 0x2800, 0xff88, 0x88ff, 0x0001, 0xe9c9,
+    0x1813, 0x481f, 0x180f, 0xeeef, 0x200f, 0xf777, 0x7777, 0x0001, 0x2011, 0x2049, 0x7777, 0x77dd, 0x0001, 0xffee, 0xeeee, 0x0001,
+    0xb492, 0x0810, 0xffee, 0x0001, 0x08df, 0x6667, 0x0001, 0xee66, 0x7777, 0x0001, 0xee77, 0x7eee, 0x202f, 0x7777, 0x7fff, 0x0001,
+    0x7fff, 0x6f7a, 0xfffe, 0x0001, 0x384f, 0xff77, 0x0001, 0x507f, 0x114b, 0x700f, 0xee77, 0x0801, 0x581f, 0x1001, 0x300f, 0x7444,
+    0x0801, 0x777e, 0x937e, 0x0001, 0xeeee, 0xe777, 0x200f, 0x44ff, 0xffff, 0x0001, 0x1007, 0x77ff, 0x28b1, 0x1099, 0x1013, 0x30c1,
+    0x30bf, 0x380f, 0xf444, 0xbd73, 0x0801, 0xff44, 0x0801, 0x280f, 0x0197, 0x0800, 0x7777, 0x0001, 0xff44, 0x294f, 0x180e, 0x4893,
+    0x4447, 0x7777, 0x0001, 0x006c, 0xf9f9, 0x0001, 0x3000, 0x00d6, 0x28d8, 0x2800, 0x4444, 0x444f, 0x0001, 0x120b, 0x512f, 0x1043,
+    0x01c0, 0x608f, 0x4444, 0x44ff, 0x282f, 0x4e50, 0x4ddd, 0x0001, 0xffff, 0xf777, 0x0801, 0x287f, 0x120f, 0x7ee4, 0x4ddd, 0x0001,
+    0xf44e, 0x283f
+};
@@ -0,0 +1,98 @@
+/* Autogenerated by MapBaker */
+
+#ifndef MAPDATA_H
+#define MAPDATA_H
+
+#include <genesis.h>
+
+// TILEMAP_FG with PAL1, priority 0 and base tile 935 already applied.
+#define TILEMAP_FG_VDP_BASE_TILE 935
+#define TILEMAP_FG_VDP_TILE_WIDTH 80
+#define TILEMAP_FG_VDP_TILE_HEIGHT 66
+#define TILEMAP_FG_VDP_TILE_COUNT 5280
+extern const uint16_t TILEMAP_FG_VDP[TILEMAP_FG_VDP_TILE_COUNT];
+
+// TILEMAP_FG_VDP stored column by column, so each map column is contiguous.
+#define TILEMAP_FG_VDP_COLUMNS_TILE_WIDTH 80
+#define TILEMAP_FG_VDP_COLUMNS_TILE_HEIGHT 66
+#define TILEMAP_FG_VDP_COLUMNS_TILE_COUNT 5280
+extern const uint16_t TILEMAP_FG_VDP_COLUMNS[TILEMAP_FG_VDP_COLUMNS_TILE_COUNT];
+
+// TILEMAP_FG_VDP as 16x16 tile chunks of 2x2 tile metatiles (3330 bytes instead of 10560).
+//   _LAYOUT: chunk index for each chunk of the map, row by row.
+//   _CHUNKS: metatile index for each metatile of a chunk, row by row.
+//   _METATILES: name-table words for each tile of a metatile, row by row.
+#define TILEMAP_FG_CHUNKED_TILE_WIDTH 80
+#define TILEMAP_FG_CHUNKED_TILE_HEIGHT 66
+#define TILEMAP_FG_CHUNKED_LAYOUT_WIDTH 5
+#define TILEMAP_FG_CHUNKED_LAYOUT_HEIGHT 5
+#define TILEMAP_FG_CHUNKED_LAYOUT_COUNT 25
+extern const uint16_t TILEMAP_FG_CHUNKED_LAYOUT[TILEMAP_FG_CHUNKED_LAYOUT_COUNT];
+#define TILEMAP_FG_CHUNKED_CHUNKS_COUNT 1408
+extern const uint16_t TILEMAP_FG_CHUNKED_CHUNKS[TILEMAP_FG_CHUNKED_CHUNKS_COUNT];
+#define TILEMAP_FG_CHUNKED_METATILES_COUNT 232
+extern const uint16_t TILEMAP_FG_CHUNKED_METATILES[TILEMAP_FG_CHUNKED_METATILES_COUNT];
+
+// Start of each row of TILEMAP_FG, so rows can be found without multiplying.
+#define TILEMAP_FG_ROWS_COUNT 66
+extern const uint16_t* const TILEMAP_FG_ROWS[TILEMAP_FG_ROWS_COUNT];
+
+// Start of each row of TILEMAP_FG_VDP, so rows can be found without multiplying.
+#define TILEMAP_FG_VDP_ROWS_COUNT 66
+extern const uint16_t* const TILEMAP_FG_VDP_ROWS[TILEMAP_FG_VDP_ROWS_COUNT];
+
+// TILESET_FG compressed for TileDecoder, 64 tiles to a block (358 bytes instead of 1408).
+//   _BLOCKS: offset of each block in words.
+#define TILESET_FG_LZ_TILE_COUNT 44
+#define TILESET_FG_LZ_BLOCK_TILES 64
+#define TILESET_FG_LZ_BLOCKS_COUNT 1
+extern const uint16_t TILESET_FG_LZ_BLOCKS[TILESET_FG_LZ_BLOCKS_COUNT];
+#define TILESET_FG_LZ_WORD_COUNT 178
+extern const uint16_t TILESET_FG_LZ[TILESET_FG_LZ_WORD_COUNT];
+
+// TILEMAP_BG with PAL0, priority 0 and base tile 1 already applied.
+#define TILEMAP_BG_VDP_BASE_TILE 1
+#define TILEMAP_BG_VDP_TILE_WIDTH 60
+#define TILEMAP_BG_VDP_TILE_HEIGHT 47
+#define TILEMAP_BG_VDP_TILE_COUNT 2820
+extern const uint16_t TILEMAP_BG_VDP[TILEMAP_BG_VDP_TILE_COUNT];
+
+// TILEMAP_BG_VDP stored column by column, so each map column is contiguous.
+#define TILEMAP_BG_VDP_COLUMNS_TILE_WIDTH 60
+#define TILEMAP_BG_VDP_COLUMNS_TILE_HEIGHT 47
+#define TILEMAP_BG_VDP_COLUMNS_TILE_COUNT 2820
+extern const uint16_t TILEMAP_BG_VDP_COLUMNS[TILEMAP_BG_VDP_COLUMNS_TILE_COUNT];
+
+// TILEMAP_BG_VDP as 16x16 tile chunks of 2x2 tile metatiles (3464 bytes instead of 5640).
+//   _LAYOUT: chunk index for each chunk of the map, row by row.
+//   _CHUNKS: metatile index for each metatile of a chunk, row by row.
+//   _METATILES: name-table words for each tile of a metatile, row by row.
+#define TILEMAP_BG_CHUNKED_TILE_WIDTH 60
+#define TILEMAP_BG_CHUNKED_TILE_HEIGHT 47
+#define TILEMAP_BG_CHUNKED_LAYOUT_WIDTH 4
+#define TILEMAP_BG_CHUNKED_LAYOUT_HEIGHT 3
+#define TILEMAP_BG_CHUNKED_LAYOUT_COUNT 12
+extern const uint16_t TILEMAP_BG_CHUNKED_LAYOUT[TILEMAP_BG_CHUNKED_LAYOUT_COUNT];
+#define TILEMAP_BG_CHUNKED_CHUNKS_COUNT 640
+extern const uint16_t TILEMAP_BG_CHUNKED_CHUNKS[TILEMAP_BG_CHUNKED_CHUNKS_COUNT];
+#define TILEMAP_BG_CHUNKED_METATILES_COUNT 1080
+extern const uint16_t TILEMAP_BG_CHUNKED_METATILES[TILEMAP_BG_CHUNKED_METATILES_COUNT];
+
+// Start of each row of TILEMAP_BG, so rows can be found without multiplying.
+#define TILEMAP_BG_ROWS_COUNT 47
+extern const uint16_t* const TILEMAP_BG_ROWS[TILEMAP_BG_ROWS_COUNT];
+
+// Start of each row of TILEMAP_BG_VDP, so rows can be found without multiplying.
+#define TILEMAP_BG_VDP_ROWS_COUNT 47
+extern const uint16_t* const TILEMAP_BG_VDP_ROWS[TILEMAP_BG_VDP_ROWS_COUNT];
+
+// TILESET_BG compressed for TileDecoder, 64 tiles to a block (13730 bytes instead of 29888).
+//   _BLOCKS: offset of each block in words.
+#define TILESET_BG_LZ_TILE_COUNT 934
+#define TILESET_BG_LZ_BLOCK_TILES 64
+#define TILESET_BG_LZ_BLOCKS_COUNT 15
+extern const uint16_t TILESET_BG_LZ_BLOCKS[TILESET_BG_LZ_BLOCKS_COUNT];
+#define TILESET_BG_LZ_WORD_COUNT 6850
+extern const uint16_t TILESET_BG_LZ[TILESET_BG_LZ_WORD_COUNT];
+
+#endif
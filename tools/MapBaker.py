@@ -0,0 +1,380 @@
+#!/usr/bin/env python3
+"""Generates derived map data from the GenImageTool output.
+
+GenImageTool only knows about images, so anything the engine wants precomputed from the
+tilemaps (VDP name-table words, alternate layouts, ...) is produced here instead.  The
+script file follows the same format as img/graphics.txt:
+
+    out_h "../src/mapdata.h" MAPDATA_H
+    out_c "../src/mapdata.c"
+    source "../src/graphics.c"
+
+    # prebaked <output name> <source tilemap> <palette> <priority> <base tile index>
+    prebaked TILEMAP_FG_VDP TILEMAP_FG 1 0 935
+
+    # columns <output name> <source tilemap>
+    columns TILEMAP_FG_VDP_COLUMNS TILEMAP_FG_VDP
+
+    # chunked <output name> <source tilemap>
+    chunked TILEMAP_FG_CHUNKED TILEMAP_FG_VDP
+
+    # rows <output name> <source tilemap>
+    rows TILEMAP_FG_VDP_ROWS TILEMAP_FG_VDP
+
+    # compressed <output name> <source tileset> <tiles per block>
+    compressed TILESET_FG_LZ TILESET_FG 64
+
+Paths are relative to the script file.  To regenerate src/mapdata.c and src/mapdata.h:
+
+    python3 tools/MapBaker.py img/mapdata.txt
+"""
+
+import os
+import re
+import shlex
+import sys
+
+
+def parse_source(path):
+    """Returns {name: [values]} for every uint16_t array in a GenImageTool .c file."""
+    with open(path) as f:
+        text = f.read()
+
+    arrays = {}
+    for match in re.finditer(r"const uint16_t (\w+)\[[^\]]*\] =\s*\{([^}]*)\};", text):
+        arrays[match.group(1)] = [int(value, 0) for value in match.group(2).replace("\n", " ").split(",") if value.strip()]
+
+    return arrays
+
+
+def parse_tilesets(path):
+    """Returns {name: [words]} for every tileset (uint32_t [][8] array) in a GenImageTool .c file, as big-endian words."""
+    with open(path) as f:
+        text = f.read()
+
+    tilesets = {}
+    for match in re.finditer(r"const uint32_t (\w+)\[[^\]]*\]\[8\] =\s*\{(.*?)\};", text, re.DOTALL):
+        words = []
+        for value in re.findall(r"0x[0-9a-fA-F]+", match.group(2)):
+            value = int(value, 16)
+            words += [value >> 16, value & 0xFFFF]
+        tilesets[match.group(1)] = words
+
+    return tilesets
+
+
+def parse_header(path):
+    """Returns {name: value} for every integer #define in a GenImageTool .h file."""
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            match = re.match(r"#define (\w+) (\d+)\s*$", line)
+            if match:
+                defines[match.group(1)] = int(match.group(2))
+
+    return defines
+
+
+def tile_attr(palette, priority, base_tile):
+    return (priority << 15) | (palette << 13) | base_tile
+
+
+# Chunked maps: the map is cut into CHUNK_TILES x CHUNK_TILES tile chunks, each made of METATILE_TILES x METATILE_TILES
+# tile metatiles.  Must match SCROLLINGMAP_CHUNK_* in ScrollingMap.h.
+METATILE_TILES = 2
+CHUNK_TILES = 16
+CHUNK_METATILES = CHUNK_TILES // METATILE_TILES
+
+# Compressed tilesets: each block of tiles is compressed on its own, so it can be decoded into a small buffer and sent
+# to VRAM before the next.  A block is a stream of words: a flag word, then one item per flag bit (most significant
+# first) until the next flag word.  A clear bit is a literal word.  A set bit is a match word: copy (word >> 11) + 2
+# words from (word & 0x7FF) + 1 words back in the block's output.  Must match src/TileDecoder.h.
+TILE_WORDS = 16
+MAX_BLOCK_TILES = 64
+MATCH_MIN_WORDS = 2
+MATCH_MAX_WORDS = 33
+MATCH_MAX_OFFSET = 2048
+MATCH_MAX_CANDIDATES = 256
+
+
+def compress_block(words):
+    """Greedy LZ over words, finding matches through a table of where each pair of words was last seen."""
+    output = []
+    flags_index = None
+    flag_bit = 0
+    positions = {}
+    i = 0
+    while i < len(words):
+        best_length = 0
+        best_offset = 0
+        if i + 1 < len(words):
+            candidates = positions.get((words[i], words[i + 1]), [])
+            for start in reversed(candidates[-MATCH_MAX_CANDIDATES:]):
+                if i - start > MATCH_MAX_OFFSET:
+                    break
+
+                length = 0
+                while length < MATCH_MAX_WORDS and i + length < len(words) and words[start + length] == words[i + length]:
+                    length += 1
+
+                if length > best_length:
+                    best_length = length
+                    best_offset = i - start
+                    if length == MATCH_MAX_WORDS:
+                        break
+
+        if flag_bit == 0:
+            flags_index = len(output)
+            output.append(0)
+            flag_bit = 0x8000
+
+        if best_length >= MATCH_MIN_WORDS:
+            output[flags_index] |= flag_bit
+            output.append(((best_length - MATCH_MIN_WORDS) << 11) | (best_offset - 1))
+            length = best_length
+        else:
+            output.append(words[i])
+            length = 1
+
+        for j in range(i, i + length):
+            if j + 1 < len(words):
+                positions.setdefault((words[j], words[j + 1]), []).append(j)
+        i += length
+        flag_bit >>= 1
+
+    return output
+
+
+def decompress_block(data, word_count):
+    """The decoder, to check the compressor against."""
+    output = []
+    flags = 0
+    flag_bits = 0
+    i = 0
+    while len(output) < word_count:
+        if flag_bits == 0:
+            flags = data[i]
+            i += 1
+            flag_bits = 16
+
+        if flags & 0x8000:
+            start = len(output) - ((data[i] & 0x7FF) + 1)
+            for j in range((data[i] >> 11) + MATCH_MIN_WORDS):
+                output.append(output[start + j])
+        else:
+            output.append(data[i])
+
+        i += 1
+        flags = (flags << 1) & 0xFFFF
+        flag_bits -= 1
+
+    return output
+
+
+class MapBaker:
+    def __init__(self, script_path):
+        self.script_dir = os.path.dirname(os.path.abspath(script_path))
+        self.script_path = script_path
+        self.out_h = None
+        self.out_c = None
+        self.guard = None
+        self.arrays = {}
+        self.tilesets = {}
+        self.defines = {}
+        self.includes = []
+        self.header_lines = []
+        self.source_lines = []
+
+    def path(self, name):
+        return os.path.join(self.script_dir, name)
+
+    def run(self):
+        with open(self.script_path) as f:
+            for line_number, line in enumerate(f, 1):
+                args = shlex.split(line, comments=True)
+                if not args:
+                    continue
+
+                handler = getattr(self, "cmd_" + args[0], None)
+                if handler is None:
+                    sys.exit("%s:%d: unknown command '%s'" % (self.script_path, line_number, args[0]))
+
+                handler(*args[1:])
+
+        self.write()
+
+    def cmd_out_h(self, name, guard):
+        self.out_h = name
+        self.guard = guard
+
+    def cmd_out_c(self, name):
+        self.out_c = name
+
+    def cmd_source(self, name):
+        header = os.path.splitext(name)[0] + ".h"
+        self.arrays.update(parse_source(self.path(name)))
+        self.tilesets.update(parse_tilesets(self.path(name)))
+        self.defines.update(parse_header(self.path(header)))
+        self.includes.append(os.path.basename(header))
+
+    def tilemap_size(self, tilemap):
+        return self.defines[tilemap + "_TILE_WIDTH"], self.defines[tilemap + "_TILE_HEIGHT"]
+
+    def add_array(self, name, width, height, values, line_length=None):
+        self.defines[name + "_TILE_WIDTH"] = width
+        self.defines[name + "_TILE_HEIGHT"] = height
+
+        if line_length is None:
+            line_length = width
+
+        self.header_lines.append("#define %s_TILE_WIDTH %d" % (name, width))
+        self.header_lines.append("#define %s_TILE_HEIGHT %d" % (name, height))
+        self.emit_array(name, "_TILE_COUNT", values, line_length)
+
+    def emit_array(self, name, count_suffix, values, line_length):
+        self.arrays[name] = values
+
+        self.header_lines.append("#define %s%s %d" % (name, count_suffix, len(values)))
+        self.header_lines.append("extern const uint16_t %s[%s%s];" % (name, name, count_suffix))
+
+        lines = []
+        for start in range(0, len(values), line_length):
+            lines.append("    " + ", ".join("0x%04x" % value for value in values[start:start + line_length]))
+        self.source_lines.append("const uint16_t %s[%s%s] =" % (name, name, count_suffix))
+        self.source_lines.append("{")
+        self.source_lines.append(",\n".join(lines))
+        self.source_lines.append("};")
+        self.source_lines.append("")
+
+    def cmd_prebaked(self, name, tilemap, palette, priority, base_tile):
+        width, height = self.tilemap_size(tilemap)
+        attr = tile_attr(int(palette), int(priority), int(base_tile))
+        values = [(attr + value) & 0xFFFF for value in self.arrays[tilemap]]
+
+        self.header_lines.append("// %s with PAL%s, priority %s and base tile %s already applied." % (tilemap, palette, priority, base_tile))
+        self.header_lines.append("#define %s_BASE_TILE %s" % (name, base_tile))
+        self.add_array(name, width, height, values)
+        self.header_lines.append("")
+
+    def cmd_columns(self, name, tilemap):
+        width, height = self.tilemap_size(tilemap)
+        values = self.arrays[tilemap]
+        columns = [values[row * width + column] for column in range(width) for row in range(height)]
+
+        self.header_lines.append("// %s stored column by column, so each map column is contiguous." % tilemap)
+        self.add_array(name, width, height, columns, height)
+        self.header_lines.append("")
+
+    def cmd_chunked(self, name, tilemap):
+        width, height = self.tilemap_size(tilemap)
+        values = self.arrays[tilemap]
+        layout_width = (width + CHUNK_TILES - 1) // CHUNK_TILES
+        layout_height = (height + CHUNK_TILES - 1) // CHUNK_TILES
+
+        def tile(x, y):
+            # Chunks hanging off the edge of the map are padded with tile 0.  They're never drawn.
+            return values[y * width + x] if x < width and y < height else 0
+
+        metatiles = {}
+        chunks = {}
+        layout = []
+        for chunk_y in range(layout_height):
+            for chunk_x in range(layout_width):
+                chunk = []
+                for metatile_y in range(CHUNK_METATILES):
+                    for metatile_x in range(CHUNK_METATILES):
+                        x = chunk_x * CHUNK_TILES + metatile_x * METATILE_TILES
+                        y = chunk_y * CHUNK_TILES + metatile_y * METATILE_TILES
+                        metatile = tuple(tile(x + dx, y + dy) for dy in range(METATILE_TILES) for dx in range(METATILE_TILES))
+                        chunk.append(metatiles.setdefault(metatile, len(metatiles)))
+
+                layout.append(chunks.setdefault(tuple(chunk), len(chunks)))
+
+        if len(metatiles) > 0x10000 or len(chunks) > 0x10000:
+            sys.exit("%s: too many metatiles or chunks" % name)
+
+        self.header_lines.append("// %s as %dx%d tile chunks of %dx%d tile metatiles (%d bytes instead of %d)." % (
+            tilemap, CHUNK_TILES, CHUNK_TILES, METATILE_TILES, METATILE_TILES,
+            (len(metatiles) * METATILE_TILES * METATILE_TILES + len(chunks) * CHUNK_METATILES * CHUNK_METATILES + len(layout)) * 2,
+            len(values) * 2))
+        self.header_lines.append("//   _LAYOUT: chunk index for each chunk of the map, row by row.")
+        self.header_lines.append("//   _CHUNKS: metatile index for each metatile of a chunk, row by row.")
+        self.header_lines.append("//   _METATILES: name-table words for each tile of a metatile, row by row.")
+        self.header_lines.append("#define %s_TILE_WIDTH %d" % (name, width))
+        self.header_lines.append("#define %s_TILE_HEIGHT %d" % (name, height))
+        self.header_lines.append("#define %s_LAYOUT_WIDTH %d" % (name, layout_width))
+        self.header_lines.append("#define %s_LAYOUT_HEIGHT %d" % (name, layout_height))
+        self.emit_array(name + "_LAYOUT", "_COUNT", layout, layout_width)
+        self.emit_array(name + "_CHUNKS", "_COUNT", [index for chunk in chunks for index in chunk], CHUNK_METATILES)
+        self.emit_array(name + "_METATILES", "_COUNT", [word for metatile in metatiles for word in metatile], METATILE_TILES * METATILE_TILES)
+        self.header_lines.append("")
+
+    def cmd_rows(self, name, tilemap):
+        width, height = self.tilemap_size(tilemap)
+        pointers = ["%s + %d" % (tilemap, row * width) for row in range(height)]
+
+        self.header_lines.append("// Start of each row of %s, so rows can be found without multiplying." % tilemap)
+        self.header_lines.append("#define %s_COUNT %d" % (name, height))
+        self.header_lines.append("extern const uint16_t* const %s[%s_COUNT];" % (name, name))
+        self.header_lines.append("")
+
+        lines = []
+        for start in range(0, height, 8):
+            lines.append("    " + ", ".join(pointers[start:start + 8]))
+        self.source_lines.append("const uint16_t* const %s[%s_COUNT] =" % (name, name))
+        self.source_lines.append("{")
+        self.source_lines.append(",\n".join(lines))
+        self.source_lines.append("};")
+        self.source_lines.append("")
+
+    def cmd_compressed(self, name, tileset, block_tiles):
+        words = self.tilesets[tileset]
+        if int(block_tiles) > MAX_BLOCK_TILES:
+            sys.exit("%s: blocks can be at most %d tiles" % (name, MAX_BLOCK_TILES))
+
+        block_words = int(block_tiles) * TILE_WORDS
+
+        data = []
+        blocks = []
+        for start in range(0, len(words), block_words):
+            block = words[start:start + block_words]
+            compressed = compress_block(block)
+            if decompress_block(compressed, len(block)) != block:
+                sys.exit("%s: block at tile %d doesn't decompress to the original" % (name, start // TILE_WORDS))
+
+            blocks.append(len(data))
+            data += compressed
+
+        if len(data) > 0x10000:
+            sys.exit("%s: too big for 16-bit block offsets" % name)
+
+        self.header_lines.append("// %s compressed for TileDecoder, %s tiles to a block (%d bytes instead of %d)." % (
+            tileset, block_tiles, (len(data) + len(blocks)) * 2, len(words) * 2))
+        self.header_lines.append("//   _BLOCKS: offset of each block in words.")
+        self.header_lines.append("#define %s_TILE_COUNT %d" % (name, len(words) // TILE_WORDS))
+        self.header_lines.append("#define %s_BLOCK_TILES %s" % (name, block_tiles))
+        self.emit_array(name + "_BLOCKS", "_COUNT", blocks, 16)
+        self.emit_array(name, "_WORD_COUNT", data, 16)
+        self.header_lines.append("")
+
+    def write(self):
+        with open(self.path(self.out_h), "w") as f:
+            f.write("/* Autogenerated by MapBaker */\n\n")
+            f.write("#ifndef %s\n#define %s\n\n#include <genesis.h>\n\n" % (self.guard, self.guard))
+            f.write("\n".join(self.header_lines))
+            f.write("\n#endif\n")
+
+        with open(self.path(self.out_c), "w") as f:
+            f.write("/* Autogenerated by MapBaker */\n\n")
+            for include in self.includes:
+                f.write("#include \"%s\"\n" % include)
+            f.write("#include \"%s\"\n\n" % os.path.basename(self.out_h))
+            f.write("\n".join(self.source_lines).rstrip("\n"))
+            f.write("\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("usage: MapBaker.py <script>")
+
+    MapBaker(sys.argv[1]).run()
@@ -0,0 +1,473 @@
+// Runs the engine through a set of camera paths on a PC and reports what each frame cost: bytes sent to VRAM, rows and
+// columns drawn, and how long ScrollingMap_update took on the host.  Host time only says whether a change made the
+// engine faster or slower, not how many scanlines it takes on the console.
+//
+//     make -C tools/host run
+//     tools/host/benchmark [-n frames] [-c frames.csv] [-p path.txt] [-r game.srm] [-P]
+//
+//     -n  Frames per path (default 1200).  Recordings are played for as long as they last.
+//     -c  Write every frame of every path to a CSV file.
+//     -p  Also replay a camera path file: one "x y" foreground camera position in pixels per line.
+//     -r  Also replay the joypad recording in an emulator's save (see JOYPAD_MODE_RECORD in src/JoypadHandler.h).
+//     -P  Pretend to be a PAL console (bigger DMA budget).
+
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "DemoRecording.h"
+#include "DMAScheduler.h"
+#include "JoypadHandler.h"
+#include "MockSGDK.h"
+#include "ScrollingMap.h"
+#include "SramFile.h"
+
+#define DEFAULT_FRAMES 1200
+
+// A camera path.  Each frame either input returns the joypad state, which goes through Joypad_update like the demo's,
+// or position sets the foreground camera position directly.
+typedef struct
+{
+    const char* name;
+    u16 (*input)(u32 frame);
+    void (*position)(u32 frame, u32* cameraPixelX, u32* cameraPixelY);
+} CameraPath;
+
+typedef struct
+{
+    u32 frames;
+    uint64_t dmaBytes;
+    u32 maxDmaBytes;
+    u32 framesOverBudget;
+    u32 droppedDmas;
+    uint64_t seams;
+    u16 maxSeams;
+    uint64_t updateNs;
+    uint64_t maxUpdateNs;
+} PathStats;
+
+u16 panRight(u32 frame);
+u16 dashRight(u32 frame);
+u16 panDown(u32 frame);
+u16 dashDown(u32 frame);
+u16 panDiagonal(u32 frame);
+u16 dashDiagonal(u32 frame);
+u16 wander(u32 frame);
+void teleport(u32 frame, u32* cameraPixelX, u32* cameraPixelY);
+void replayFile(u32 frame, u32* cameraPixelX, u32* cameraPixelY);
+u16 replayRecording(u32 frame);
+u16 bounce(u16 buttons);
+u32 nextRandom();
+bool loadPathFile(const char* fileName);
+bool loadRecording(const char* fileName, u32* frames);
+void runPath(const CameraPath* path, u32 frames, FILE* csv);
+uint64_t getTimeNs();
+
+const CameraPath cameraPaths[] =
+{
+    { "pan-right", panRight, NULL },
+    { "dash-right", dashRight, NULL },
+    { "pan-down", panDown, NULL },
+    { "dash-down", dashDown, NULL },
+    { "pan-diagonal", panDiagonal, NULL },
+    { "dash-diagonal", dashDiagonal, NULL },
+    { "wander", wander, NULL },
+    { "teleport", NULL, teleport }
+};
+
+// Where the camera was at the start of the previous frame, and what was held then, so bounce can tell when the camera
+// ran into the edge of the map.
+u32 previousCameraPixelX;
+u32 previousCameraPixelY;
+u16 previousButtons;
+bool bounceX;
+bool bounceY;
+
+u32 randomState;
+
+// Positions read by loadPathFile, as x, y pairs.
+u32* filePositions;
+u32 filePositionCount;
+
+int main(int argc, char** argv)
+{
+    u32 frames = DEFAULT_FRAMES;
+    const char* csvFileName = NULL;
+    const char* pathFileName = NULL;
+    const char* recordingFileName = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:c:p:r:P")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                frames = strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                csvFileName = optarg;
+                break;
+            case 'p':
+                pathFileName = optarg;
+                break;
+            case 'r':
+                recordingFileName = optarg;
+                break;
+            case 'P':
+                IS_PALSYSTEM = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n frames] [-c frames.csv] [-p path.txt] [-r game.srm] [-P]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    FILE* csv = NULL;
+    if (csvFileName != NULL)
+    {
+        csv = fopen(csvFileName, "w");
+        if (csv == NULL)
+        {
+            perror(csvFileName);
+            return 1;
+        }
+
+        fprintf(csv, "path,frame,camera_x,camera_y,dma_bytes,dma_count,seams,scroll_writes,update_ns\n");
+    }
+
+    printf("%-14s %6s %9s %9s %6s %7s %9s %9s %11s %11s\n", "path", "frames", "avg dma", "max dma", "over", "dropped",
+        "avg seams", "max seams", "avg us", "max us");
+
+    u16 i;
+    for (i = 0; i < sizeof(cameraPaths) / sizeof(CameraPath); i++)
+    {
+        runPath(&cameraPaths[i], frames, csv);
+    }
+
+    // Replays start with the path, right before ScrollingMap_init puts the camera back where recording started.
+    u32 recordingFrames = 0;
+    for (i = 0; i < demoRecordingRunCount; i++)
+    {
+        recordingFrames += demoRecording[i].frames;
+    }
+
+    CameraPath demoPath = { "demo-recording", replayRecording, NULL };
+    Joypad_replay(demoRecording, demoRecordingRunCount);
+    runPath(&demoPath, recordingFrames, csv);
+    Joypad_stop();
+
+    if (pathFileName != NULL)
+    {
+        if (!loadPathFile(pathFileName))
+        {
+            return 1;
+        }
+
+        CameraPath filePath = { pathFileName, NULL, replayFile };
+        runPath(&filePath, filePositionCount, csv);
+    }
+
+    if (recordingFileName != NULL)
+    {
+        if (!loadRecording(recordingFileName, &recordingFrames))
+        {
+            return 1;
+        }
+
+        CameraPath recordingPath = { recordingFileName, replayRecording, NULL };
+        Joypad_replayFromSram();
+        runPath(&recordingPath, recordingFrames, csv);
+        Joypad_stop();
+    }
+
+    if (csv != NULL)
+    {
+        fclose(csv);
+    }
+
+    return 0;
+}
+
+void runPath(const CameraPath* path, u32 frames, FILE* csv)
+{
+    PathStats stats;
+    memset(&stats, 0, sizeof(stats));
+
+    u16 dmaBudget = IS_PALSYSTEM ? DMA_BUDGET_PAL : DMA_BUDGET_NTSC;
+
+    // Every path starts from a freshly loaded map.
+    Mock_reset();
+    DMAScheduler_init();
+    ScrollingMap_init();
+
+    previousCameraPixelX = fgCameraPixelX;
+    previousCameraPixelY = fgCameraPixelY;
+    previousButtons = 0;
+    bounceX = FALSE;
+    bounceY = FALSE;
+    randomState = 1;
+
+    u32 frame;
+    for (frame = 0; frame < frames; frame++)
+    {
+        Mock_beginFrame();
+
+        u32 startCameraPixelX = fgCameraPixelX;
+        u32 startCameraPixelY = fgCameraPixelY;
+        if (path->input != NULL)
+        {
+            mockJoypad = path->input(frame);
+            Joypad_update();
+        }
+        else
+        {
+            path->position(frame, &fgCameraPixelX, &fgCameraPixelY);
+        }
+
+        previousCameraPixelX = startCameraPixelX;
+        previousCameraPixelY = startCameraPixelY;
+        previousButtons = mockJoypad;
+
+        uint64_t startNs = getTimeNs();
+        ScrollingMap_update();
+        uint64_t updateNs = getTimeNs() - startNs;
+
+        DMAScheduler_flush();
+        SYS_doVBlankProcess();
+        DMAScheduler_releaseStaging();
+        ScrollingMap_updateVDP();
+
+        u16 seams = ScrollingMap_getSeamsDrawn();
+
+        stats.frames++;
+        stats.dmaBytes += mockFrame.dmaBytes;
+        if (mockFrame.dmaBytes > stats.maxDmaBytes)
+        {
+            stats.maxDmaBytes = mockFrame.dmaBytes;
+        }
+
+        if (mockFrame.dmaBytes > dmaBudget)
+        {
+            stats.framesOverBudget++;
+        }
+
+        stats.droppedDmas += mockFrame.droppedDmas;
+        stats.seams += seams;
+        if (seams > stats.maxSeams)
+        {
+            stats.maxSeams = seams;
+        }
+
+        stats.updateNs += updateNs;
+        if (updateNs > stats.maxUpdateNs)
+        {
+            stats.maxUpdateNs = updateNs;
+        }
+
+        if (csv != NULL)
+        {
+            fprintf(csv, "%s,%u,%u,%u,%u,%u,%u,%u,%llu\n", path->name, frame, fgCameraPixelX, fgCameraPixelY,
+                mockFrame.dmaBytes, mockFrame.dmaCount, seams, mockFrame.scrollCount, (unsigned long long) updateNs);
+        }
+    }
+
+    if (stats.frames == 0)
+    {
+        return;
+    }
+
+    printf("%-14s %6u %9.1f %9u %6u %7u %9.2f %9u %11.2f %11.2f\n", path->name, stats.frames,
+        (double) stats.dmaBytes / stats.frames, stats.maxDmaBytes, stats.framesOverBudget, stats.droppedDmas,
+        (double) stats.seams / stats.frames, stats.maxSeams,
+        (double) stats.updateNs / stats.frames / 1000.0, (double) stats.maxUpdateNs / 1000.0);
+}
+
+u16 panRight(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_RIGHT);
+}
+
+u16 dashRight(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_RIGHT | BUTTON_A);
+}
+
+u16 panDown(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_DOWN);
+}
+
+u16 dashDown(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_DOWN | BUTTON_A);
+}
+
+u16 panDiagonal(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_RIGHT | BUTTON_DOWN);
+}
+
+u16 dashDiagonal(u32 frame)
+{
+    (void) frame;
+    return bounce(BUTTON_RIGHT | BUTTON_DOWN | BUTTON_A);
+}
+
+// Picks a new direction (or none) and speed every so often, like someone exploring the level.
+u16 wander(u32 frame)
+{
+    static const u16 directions[] =
+    {
+        0, BUTTON_LEFT, BUTTON_RIGHT, BUTTON_UP, BUTTON_DOWN,
+        BUTTON_LEFT | BUTTON_UP, BUTTON_LEFT | BUTTON_DOWN, BUTTON_RIGHT | BUTTON_UP, BUTTON_RIGHT | BUTTON_DOWN
+    };
+    static u16 buttons;
+    static u32 nextChange;
+
+    if (frame == 0)
+    {
+        nextChange = 0;
+    }
+
+    if (frame == nextChange)
+    {
+        buttons = directions[nextRandom() % (sizeof(directions) / sizeof(u16))];
+        if ((nextRandom() & 3) == 0)
+        {
+            buttons |= BUTTON_A;
+        }
+
+        nextChange = frame + 20 + (nextRandom() % 40);
+    }
+
+    return buttons;
+}
+
+// Jumps somewhere else on the map every second and a half, as a door or a camera cut would.
+void teleport(u32 frame, u32* cameraPixelX, u32* cameraPixelY)
+{
+    if (frame % 90 == 0)
+    {
+        // Anything past the edge of the map is clamped by ScrollingMap_update.
+        *cameraPixelX = nextRandom() % 1024;
+        *cameraPixelY = nextRandom() % 1024;
+    }
+}
+
+void replayFile(u32 frame, u32* cameraPixelX, u32* cameraPixelY)
+{
+    *cameraPixelX = filePositions[frame << 1];
+    *cameraPixelY = filePositions[(frame << 1) + 1];
+}
+
+// Holds buttons, but turns around along whichever axis the camera stopped moving on last frame (the edge of the map).
+u16 bounce(u16 buttons)
+{
+    if ((previousButtons & (BUTTON_LEFT | BUTTON_RIGHT)) && fgCameraPixelX == previousCameraPixelX)
+    {
+        bounceX = !bounceX;
+    }
+
+    if ((previousButtons & (BUTTON_UP | BUTTON_DOWN)) && fgCameraPixelY == previousCameraPixelY)
+    {
+        bounceY = !bounceY;
+    }
+
+    if (bounceX)
+    {
+        buttons ^= (buttons & (BUTTON_LEFT | BUTTON_RIGHT)) ? (BUTTON_LEFT | BUTTON_RIGHT) : 0;
+    }
+
+    if (bounceY)
+    {
+        buttons ^= (buttons & (BUTTON_UP | BUTTON_DOWN)) ? (BUTTON_UP | BUTTON_DOWN) : 0;
+    }
+
+    return buttons;
+}
+
+// A small LCG, so every run of a path is the same.
+u32 nextRandom()
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 16) & 0x7FFF;
+}
+
+// Joypad_update ignores the joypad while it's replaying a recording.
+u16 replayRecording(u32 frame)
+{
+    (void) frame;
+    return 0;
+}
+
+bool loadPathFile(const char* fileName)
+{
+    FILE* file = fopen(fileName, "r");
+    if (file == NULL)
+    {
+        perror(fileName);
+        return FALSE;
+    }
+
+    u32 capacity = 1024;
+    filePositions = malloc(capacity * sizeof(u32) * 2);
+    filePositionCount = 0;
+
+    unsigned long x;
+    unsigned long y;
+    while (fscanf(file, "%lu %lu", &x, &y) == 2)
+    {
+        if (filePositionCount == capacity)
+        {
+            capacity <<= 1;
+            filePositions = realloc(filePositions, capacity * sizeof(u32) * 2);
+        }
+
+        filePositions[filePositionCount << 1] = x;
+        filePositions[(filePositionCount << 1) + 1] = y;
+        filePositionCount++;
+    }
+
+    fclose(file);
+    return TRUE;
+}
+
+// Put a save's SRAM in the mock's, for Joypad_replayFromSram, and count the frames its recording lasts.
+bool loadRecording(const char* fileName, u32* frames)
+{
+    if (!SramFile_load(fileName))
+    {
+        return FALSE;
+    }
+
+    if (memcmp(sramFile + JOYPAD_SRAM_START, JOYPAD_SRAM_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s: no joypad recording in this save\n", fileName);
+        return FALSE;
+    }
+
+    memcpy(mockSram, sramFile, MOCK_SRAM_SIZE);
+
+    u16 runCount = SramFile_readWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT);
+    *frames = 0;
+    u16 i;
+    for (i = 0; i < runCount && i < JOYPAD_SRAM_MAX_RUNS; i++)
+    {
+        *frames += SramFile_readWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_SIZE + (i * JOYPAD_SRAM_RUN_SIZE));
+    }
+
+    return TRUE;
+}
+
+uint64_t getTimeNs()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000000) + now.tv_nsec;
+}
@@ -0,0 +1,431 @@
+// Walks the camera around the map at a range of speeds and checks every frame that what the planes show (according to
+// VdpModel) matches the map drawn straight from ROM at the same camera position.  Any column or row the engine failed
+// to draw, drew in the wrong place or drew from the wrong part of the map shows up on the frame it happens.  Frames in
+// the middle of a screen redraw aren't checked, but a redraw that goes on for long while the camera is still fails.
+// With SCROLLINGMAP_DOUBLE_BUFFER, the walk also cuts elsewhere now and then, and whatever has a back name table
+// is checked on the frame of the cut.  Every walk is run again with a DMA budget too small for both planes' seams, where
+// the background is allowed to fall a few frames behind as long as it catches up.  No frame may send more than its DMA
+// budget, except for the scroll table and foreground seams.
+//
+//     make -C tools/host test
+//     tools/host/fuzz [-n frames] [-s seeds]
+
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "DMAScheduler.h"
+#include "graphics.h"
+#include "JoypadHandler.h"
+#include "mapdata.h"
+#include "MathUtil.h"
+#include "MockSGDK.h"
+#include "ScrollingMap.h"
+#include "VdpModel.h"
+
+#define DEFAULT_FRAMES 500
+#define DEFAULT_SEEDS 2
+
+// A budget the foreground's seams (and with line scrolling, the scroll table's 896 bytes) often fill by themselves, so
+// the background's have to wait.
+#define LOW_DMA_BUDGET ((SCROLLINGMAP_LINE_SCROLL != 0) ? 1200 : 400)
+
+// Frames plane B may go on differing from the map under LOW_DMA_BUDGET before it has to have caught up.
+#define MAX_STALE_BG_FRAMES 12
+
+// Bytes in the tallest column a redraw draws.
+#define REDRAW_COLUMN_BYTES (VDP_PLANE_TILE_HEIGHT << 1)
+
+#define FG_CAMERA_LIMIT_X (TILE_TO_PIXEL(TILEMAP_FG_TILE_WIDTH) - SCREEN_PIXEL_WIDTH)
+#define FG_CAMERA_LIMIT_Y (TILE_TO_PIXEL(TILEMAP_FG_TILE_HEIGHT) - SCREEN_PIXEL_HEIGHT)
+#define BG_CAMERA_LIMIT_X (TILE_TO_PIXEL(TILEMAP_BG_TILE_WIDTH) - SCREEN_PIXEL_WIDTH)
+#define BG_CAMERA_LIMIT_Y (TILE_TO_PIXEL(TILEMAP_BG_TILE_HEIGHT) - SCREEN_PIXEL_HEIGHT)
+
+// The fastest the camera moves, in pixels per frame.  The last few are faster than the engine draws seams, so they
+// test the full redraw.
+const u16 speeds[] = { 1, 2, 3, 4, 7, 8, 9, 16, 24, 31, 64, 300 };
+
+// The demo's bands.
+const ParallaxBand fuzzBands[] =
+{
+    { 0, FIX16(0.25) },
+    { 64, FIX16(0.375) },
+    { 144, FIX16(0.5) }
+};
+
+u8 expectedPixels[VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT];
+u8 actualPixels[VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT];
+
+u32 randomState;
+
+bool runWalk(u16 speed, u32 seed, u32 frames, bool useBands, u16 dmaBudget);
+bool checkPlane(VDPPlane plane, u32 frame, const ParallaxBand* bands, u16 bandCount);
+u32 findDifference(VDPPlane plane, const ParallaxBand* bands, u16 bandCount);
+void renderMap(VDPPlane plane, const ParallaxBand* bands, u16 bandCount, u8* pixels);
+u16 maxRedrawFrames(u16 dmaBudget);
+u32 nextRandom();
+
+int main(int argc, char** argv)
+{
+    u32 frames = DEFAULT_FRAMES;
+    u32 seeds = DEFAULT_SEEDS;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:s:")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                frames = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                seeds = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n frames] [-s seeds]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    u32 walks = 0;
+    u32 failures = 0;
+
+    const u16 budgets[] = { IS_PALSYSTEM ? DMA_BUDGET_PAL : DMA_BUDGET_NTSC, LOW_DMA_BUDGET };
+    u16 budget;
+    for (budget = 0; budget < sizeof(budgets) / sizeof(u16); budget++)
+    {
+        u16 bandMode;
+        for (bandMode = 0; bandMode < ((SCROLLINGMAP_LINE_SCROLL != 0) ? 2 : 1); bandMode++)
+        {
+            u16 i;
+            for (i = 0; i < sizeof(speeds) / sizeof(u16); i++)
+            {
+                u32 seed;
+                for (seed = 1; seed <= seeds; seed++)
+                {
+                    walks++;
+                    if (!runWalk(speeds[i], seed, frames, bandMode != 0, budgets[budget]))
+                    {
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%u of %u walks passed\n", walks - failures, walks);
+    return failures != 0;
+}
+
+// Returns FALSE at the first frame that doesn't match.
+bool runWalk(u16 speed, u32 seed, u32 frames, bool useBands, u16 dmaBudget)
+{
+    const ParallaxBand* bands = NULL;
+    u16 bandCount = 0;
+
+    Mock_reset();
+    VdpModel_init(SCROLLINGMAP_LINE_SCROLL != 0);
+    DMAScheduler_init();
+    DMAScheduler_setBudget(dmaBudget);
+    ScrollingMap_init();
+    ScrollingMap_setLagPolicy(SCROLLINGMAP_LAG_POLICY_CATCH_UP);
+    if (useBands)
+    {
+        bands = fuzzBands;
+        bandCount = sizeof(fuzzBands) / sizeof(ParallaxBand);
+        ScrollingMap_setParallaxBands(bands, bandCount);
+    }
+
+    randomState = seed;
+    s32 cameraX = 0;
+    s32 cameraY = 0;
+    s32 velocityX = speed;
+    s32 velocityY = 0;
+    u16 stillRedrawFrames = 0;
+    u16 redrawFrameLimit = maxRedrawFrames(dmaBudget);
+
+    // Only a budget below the console's default may leave the background behind.
+    bool lowBudget = (dmaBudget == LOW_DMA_BUDGET);
+    u16 staleBgFrameLimit = lowBudget ? MAX_STALE_BG_FRAMES : 0;
+    u16 staleBgFrames = 0;
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+    bool cutPrepared = FALSE;
+    u16 cutDeadline = 0;
+    s32 cutX = 0;
+    s32 cutY = 0;
+#endif
+
+    u32 frame;
+    for (frame = 0; frame < frames; frame++)
+    {
+        // Change direction (and speed, up to the walk's top speed) now and then, and occasionally jump somewhere else
+        // altogether.
+        if (nextRandom() % 40 == 0)
+        {
+            u16 direction = nextRandom() % 9;
+            velocityX = ((s32) (direction % 3) - 1) * (s32) ((nextRandom() % speed) + 1);
+            velocityY = ((s32) (direction / 3) - 1) * (s32) ((nextRandom() % speed) + 1);
+        }
+
+        if (nextRandom() % 500 == 0)
+        {
+            cameraX = nextRandom() % (FG_CAMERA_LIMIT_X + 1);
+            cameraY = nextRandom() % (FG_CAMERA_LIMIT_Y + 1);
+        }
+
+        // Now and then pretend the game took too long and missed a few vblanks, so the camera has moved further than
+        // usual by the next update.
+        u16 lag = (nextRandom() % 16 == 0) ? 1 + (nextRandom() % SCROLLINGMAP_MAX_CATCH_UP_FRAMES) : 0;
+        vtimer += lag;
+
+        cameraX += velocityX * (1 + lag);
+        cameraY += velocityY * (1 + lag);
+        cameraX = (cameraX < 0) ? 0 : (cameraX > FG_CAMERA_LIMIT_X) ? FG_CAMERA_LIMIT_X : cameraX;
+        cameraY = (cameraY < 0) ? 0 : (cameraY > FG_CAMERA_LIMIT_Y) ? FG_CAMERA_LIMIT_Y : cameraY;
+
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+        // Now and then prepare a cut somewhere else and carry on walking until it's ready, or until a few frames have
+        // gone by so the cut has to finish it off.
+        bool cut = FALSE;
+        if (!cutPrepared && nextRandom() % 120 == 0)
+        {
+            cutX = nextRandom() % (FG_CAMERA_LIMIT_X + 1);
+            cutY = nextRandom() % (FG_CAMERA_LIMIT_Y + 1);
+            cutDeadline = nextRandom() % 8;
+            cutPrepared = TRUE;
+            ScrollingMap_prepareCut(cutX, cutY);
+        }
+        else if (cutPrepared && (ScrollingMap_isCutReady() || cutDeadline-- == 0))
+        {
+            cameraX = cutX;
+            cameraY = cutY;
+            cut = TRUE;
+            cutPrepared = FALSE;
+        }
+#endif
+
+        bool cameraMoved = (fgCameraPixelX != cameraX || fgCameraPixelY != cameraY);
+        fgCameraPixelX = cameraX;
+        fgCameraPixelY = cameraY;
+
+        Mock_beginFrame();
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+        if (cut)
+        {
+            ScrollingMap_cut();
+        }
+#endif
+        ScrollingMap_update();
+        DMAScheduler_flush();
+        SYS_doVBlankProcess();
+        DMAScheduler_releaseStaging();
+        ScrollingMap_updateVDP();
+
+        if (mockFrame.droppedDmas != 0)
+        {
+            printf("speed %u seed %u%s%s frame %u: %u DMAs didn't fit in SGDK's queue\n", speed, seed,
+                useBands ? " bands" : "", lowBudget ? " low budget" : "", frame, mockFrame.droppedDmas);
+            return FALSE;
+        }
+
+        // Only the scroll table, which claims its share first, and the foreground's seams, which always go out, may take a
+        // frame over its budget.
+        u16 scrollBytes = DMAScheduler_getLastFrameBytesAt(DMA_PRIORITY_SCROLL);
+        u16 allowedBytes = ((scrollBytes > dmaBudget) ? scrollBytes : dmaBudget)
+            + DMAScheduler_getLastFrameBytesAt(DMA_PRIORITY_FG);
+        if (DMAScheduler_getLastFrameBytes() > allowedBytes)
+        {
+            printf("speed %u seed %u%s%s frame %u: %u DMA bytes, over the %u allowed\n", speed, seed,
+                useBands ? " bands" : "", lowBudget ? " low budget" : "", frame, DMAScheduler_getLastFrameBytes(),
+                allowedBytes);
+            return FALSE;
+        }
+
+#if (SCROLLINGMAP_DOUBLE_BUFFER != 0)
+        // Whatever has a back table has to be all there straight after a cut.
+        if (cut && (!checkPlane(BG_A, frame, bands, bandCount)
+            || (SCROLLINGMAP_BG_BACK_PLANE_ADDR != 0 && !checkPlane(BG_B, frame, bands, bandCount))))
+        {
+            printf("    straight after a cut, in walk at speed %u, seed %u%s%s\n", speed, seed,
+                useBands ? ", with bands" : "", lowBudget ? ", low budget" : "");
+            return FALSE;
+        }
+#endif
+
+        if (ScrollingMap_isRedrawing())
+        {
+            stillRedrawFrames = cameraMoved ? 0 : stillRedrawFrames + 1;
+            if (stillRedrawFrames > redrawFrameLimit)
+            {
+                printf("speed %u seed %u%s%s frame %u: redraw still going after %u frames\n", speed, seed,
+                    useBands ? " bands" : "", lowBudget ? " low budget" : "", frame, stillRedrawFrames);
+                return FALSE;
+            }
+
+            continue;
+        }
+
+        stillRedrawFrames = 0;
+        if (!checkPlane(BG_A, frame, bands, bandCount))
+        {
+            printf("    in walk at speed %u, seed %u%s%s\n", speed, seed, useBands ? ", with bands" : "",
+                lowBudget ? ", low budget" : "");
+            return FALSE;
+        }
+
+        // The background may fall behind for a few frames when the budget is low, but it has to catch up.
+        if (findDifference(BG_B, bands, bandCount) == VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT)
+        {
+            staleBgFrames = 0;
+        }
+        else
+        {
+            staleBgFrames++;
+            if (staleBgFrames > staleBgFrameLimit)
+            {
+                checkPlane(BG_B, frame, bands, bandCount);
+                printf("    in walk at speed %u, seed %u%s%s, after %u frames behind\n", speed, seed,
+                    useBands ? ", with bands" : "", lowBudget ? ", low budget" : "", staleBgFrames);
+                return FALSE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+bool checkPlane(VDPPlane plane, u32 frame, const ParallaxBand* bands, u16 bandCount)
+{
+    u32 i = findDifference(plane, bands, bandCount);
+    if (i == VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT)
+    {
+        return TRUE;
+    }
+
+    printf("frame %u: plane %s differs first at screen %u,%u (camera %u,%u): expected %02x, got %02x\n", frame,
+        (plane == BG_A) ? "A" : "B", i % VDPMODEL_SCREEN_WIDTH, i / VDPMODEL_SCREEN_WIDTH, fgCameraPixelX,
+        fgCameraPixelY, expectedPixels[i], actualPixels[i]);
+    return FALSE;
+}
+
+// Returns the first pixel where the plane differs from the map, or the screen's pixel count if none does.
+u32 findDifference(VDPPlane plane, const ParallaxBand* bands, u16 bandCount)
+{
+    renderMap(plane, bands, bandCount, expectedPixels);
+    VdpModel_renderPlane(plane, actualPixels);
+
+    u32 i;
+    for (i = 0; i < VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT; i++)
+    {
+        if (expectedPixels[i] != actualPixels[i])
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+// Render the screen straight from the map and tileset in ROM, working out where each layer should be from the
+// foreground camera the same way the engine is meant to.
+void renderMap(VDPPlane plane, const ParallaxBand* bands, u16 bandCount, u8* pixels)
+{
+    // Name-table words are built from GenImageTool's maps the way the engine did before MapBaker, so the prebaked maps
+    // the engine streams are checked too.
+    const u16* map = (plane == BG_A) ? TILEMAP_FG : TILEMAP_BG;
+    const u32 (*tileset)[8] = (plane == BG_A) ? TILESET_FG : TILESET_BG;
+    u16 tilesetStartIdx = (plane == BG_A) ? MAP_TILE_START_IDX + TILESET_BG_TILE_COUNT : MAP_TILE_START_IDX;
+    u16 palette = (plane == BG_A) ? PAL1 : PAL0;
+    u16 baseTile = TILE_ATTR_FULL(palette, 0, 0, 0, tilesetStartIdx);
+    u32 mapWidth = (plane == BG_A) ? TILEMAP_FG_TILE_WIDTH : TILEMAP_BG_TILE_WIDTH;
+    u32 mapHeight = (plane == BG_A) ? TILEMAP_FG_TILE_HEIGHT : TILEMAP_BG_TILE_HEIGHT;
+
+    u32 cameraY = fgCameraPixelY;
+    if (plane == BG_B)
+    {
+        cameraY = (cameraY * SCROLLINGMAP_BG_RATIO_Y) >> FIX16_FRAC_BITS;
+        if (SCROLLINGMAP_BG_WRAP_Y == 0 && cameraY > BG_CAMERA_LIMIT_Y)
+        {
+            cameraY = BG_CAMERA_LIMIT_Y;
+        }
+    }
+
+    u16 y;
+    for (y = 0; y < VDPMODEL_SCREEN_HEIGHT; y++)
+    {
+        u32 cameraX = fgCameraPixelX;
+        if (plane == BG_B)
+        {
+            fix16 ratio = SCROLLINGMAP_BG_RATIO_X;
+            u16 i;
+            for (i = 0; i < bandCount; i++)
+            {
+                // Without line scrolling the whole background moves with the first band.
+                if (bands[i].startLine <= y && (i == 0 || SCROLLINGMAP_LINE_SCROLL != 0))
+                {
+                    ratio = bands[i].ratio;
+                }
+            }
+
+            cameraX = (cameraX * ratio) >> FIX16_FRAC_BITS;
+            if (SCROLLINGMAP_BG_WRAP_X == 0 && cameraX > BG_CAMERA_LIMIT_X)
+            {
+                cameraX = BG_CAMERA_LIMIT_X;
+            }
+        }
+
+        u32 mapY = cameraY + y;
+        const u16* mapRow = map + (((mapY >> 3) % mapHeight) * mapWidth);
+
+        u16 x;
+        for (x = 0; x < VDPMODEL_SCREEN_WIDTH; x++)
+        {
+            u32 mapX = cameraX + x;
+            u16 name = baseTile + mapRow[(mapX >> 3) % mapWidth];
+
+            u16 tileX = mapX & 7;
+            u16 tileY = mapY & 7;
+            if (name & 0x0800)
+            {
+                tileX = 7 - tileX;
+            }
+
+            if (name & 0x1000)
+            {
+                tileY = 7 - tileY;
+            }
+
+            const u32* tileData = tileset[(name & 0x07FF) - tilesetStartIdx];
+            u16 colour = (tileData[tileY] >> ((7 - tileX) << 2)) & 15;
+
+            *pixels = VDPMODEL_PIXEL(name >> 15, (name >> 13) & 3, colour);
+            pixels++;
+        }
+    }
+}
+
+// Frames a redraw may take with the camera standing still.  With parallax bands the background's view can be as wide
+// as the plane, and each plane draws a few of its columns a frame; on top of that come the frames the DMA budget holds
+// back both planes' columns, plus one to spare.
+u16 maxRedrawFrames(u16 dmaBudget)
+{
+    u16 columnFrames = (VDP_PLANE_TILE_WIDTH + SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME - 1)
+        / SCROLLINGMAP_REDRAW_COLUMNS_PER_FRAME;
+
+    // The first transfer of a frame always goes, however big.
+    u16 columnsPerFrame = dmaBudget / REDRAW_COLUMN_BYTES;
+    if (columnsPerFrame == 0)
+    {
+        columnsPerFrame = 1;
+    }
+
+    u16 budgetFrames = ((VDP_PLANE_TILE_WIDTH << 1) + columnsPerFrame - 1) / columnsPerFrame;
+    return columnFrames + budgetFrames + 1;
+}
+
+// A small LCG, so every walk can be repeated from its seed.
+u32 nextRandom()
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 16) & 0x7FFF;
+}
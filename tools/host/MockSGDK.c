@@ -0,0 +1,261 @@
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "MockSGDK.h"
+
+u16 VDP_BG_A = 0xC000;
+u16 VDP_BG_B = 0xE000;
+u16 VDP_HSCROLL_TABLE = 0xB800;
+u16 VDP_WINDOW = 0xB000;
+
+vu32 vtimer;
+u8 IS_PALSYSTEM = 0;
+u16 mockVCounter;
+u16 mockVdpStatus;
+
+u16 mockCram[64];
+
+MockFrame mockFrame;
+u16 mockJoypad;
+u8 mockSram[MOCK_SRAM_SIZE];
+void (*mockDmaHandler)(const MockDma* dma);
+void (*mockScrollHandler)(const MockScroll* scroll);
+
+// Whether the SRAM can be read and written.
+bool mockSramReadable;
+bool mockSramWritable;
+
+// Transfers waiting for the next SYS_doVBlankProcess.
+MockDma mockDmaQueue[MOCK_DMA_QUEUE_SIZE];
+u16 mockDmaQueueCount;
+
+void mockSendDma(const MockDma* dma);
+void mockWriteScroll(VDPPlane plane, bool vertical, s16 value);
+
+void Mock_reset()
+{
+    mockDmaQueueCount = 0;
+    Mock_beginFrame();
+}
+
+void Mock_beginFrame()
+{
+    mockFrame.dmaCount = 0;
+    mockFrame.dmaBytes = 0;
+    mockFrame.droppedDmas = 0;
+    mockFrame.scrollCount = 0;
+}
+
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step)
+{
+    if (mockDmaQueueCount == MOCK_DMA_QUEUE_SIZE)
+    {
+        mockFrame.droppedDmas++;
+        return FALSE;
+    }
+
+    MockDma* dma = &mockDmaQueue[mockDmaQueueCount];
+    dma->location = location;
+    dma->from = from;
+    dma->to = to;
+    dma->len = len;
+    dma->step = step;
+    dma->immediate = FALSE;
+
+    mockDmaQueueCount++;
+    return TRUE;
+}
+
+void DMA_doDma(u8 location, void* from, u16 to, u16 len, s16 step)
+{
+    MockDma dma;
+    dma.location = location;
+    dma.from = from;
+    dma.to = to;
+    dma.len = len;
+    dma.step = step;
+    dma.immediate = TRUE;
+
+    mockSendDma(&dma);
+}
+
+void VDP_setPlanSize(u16 w, u16 h)
+{
+    (void) w;
+    (void) h;
+}
+
+void VDP_loadTileData(const u32* data, u16 index, u16 num, TransferMethod tm)
+{
+    (void) tm;
+
+    // The 68000 is big endian, so each long of tile data reaches VRAM high word first.  Tiles are 8 longs each.
+    u32 wordCount = num << 4;
+    u16* words = malloc(wordCount << 1);
+    u32 i;
+    for (i = 0; i < wordCount; i += 2)
+    {
+        words[i] = data[i >> 1] >> 16;
+        words[i + 1] = data[i >> 1];
+    }
+
+    DMA_doDma(DMA_VRAM, words, index << 5, wordCount, 2);
+    free(words);
+}
+
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value)
+{
+    mockWriteScroll(plane, FALSE, value);
+}
+
+void VDP_setVerticalScroll(VDPPlane plane, s16 value)
+{
+    mockWriteScroll(plane, TRUE, value);
+}
+
+// SGDK keeps VDP_BG_A and VDP_BG_B in step with the plane base registers, which is all VdpModel looks at.
+void VDP_setBGAAddress(u16 value)
+{
+    VDP_BG_A = value;
+}
+
+void VDP_setBGBAddress(u16 value)
+{
+    VDP_BG_B = value;
+}
+
+void VDP_setPaletteColor(u16 index, u16 value)
+{
+    mockCram[index & 63] = value;
+}
+
+u16 VDP_getPaletteColor(u16 index)
+{
+    return mockCram[index & 63];
+}
+
+void VDP_setWindowHPos(bool right, u16 pos)
+{
+    (void) right;
+    (void) pos;
+}
+
+void VDP_setWindowVPos(bool down, u16 pos)
+{
+    (void) down;
+    (void) pos;
+}
+
+u16 JOY_readJoypad(u16 joy)
+{
+    (void) joy;
+    return mockJoypad;
+}
+
+void SRAM_enable()
+{
+    mockSramReadable = TRUE;
+    mockSramWritable = TRUE;
+}
+
+void SRAM_enableRO()
+{
+    mockSramReadable = TRUE;
+    mockSramWritable = FALSE;
+}
+
+void SRAM_disable()
+{
+    mockSramReadable = FALSE;
+    mockSramWritable = FALSE;
+}
+
+u8 SRAM_readByte(u32 offset)
+{
+    // With the SRAM disabled, the ROM shows through.  This ROM is smaller than 2MB, so that's open bus.
+    return (mockSramReadable && offset < MOCK_SRAM_SIZE) ? mockSram[offset] : 0xFF;
+}
+
+u16 SRAM_readWord(u32 offset)
+{
+    return (SRAM_readByte(offset) << 8) | SRAM_readByte(offset + 1);
+}
+
+u32 SRAM_readLong(u32 offset)
+{
+    return ((u32) SRAM_readWord(offset) << 16) | SRAM_readWord(offset + 2);
+}
+
+void SRAM_writeByte(u32 offset, u8 value)
+{
+    if (mockSramWritable && offset < MOCK_SRAM_SIZE)
+    {
+        mockSram[offset] = value;
+    }
+}
+
+void SRAM_writeWord(u32 offset, u16 value)
+{
+    SRAM_writeByte(offset, value >> 8);
+    SRAM_writeByte(offset + 1, value);
+}
+
+void SRAM_writeLong(u32 offset, u32 value)
+{
+    SRAM_writeWord(offset, value >> 16);
+    SRAM_writeWord(offset + 2, value);
+}
+
+void SYS_doVBlankProcess()
+{
+    u16 i;
+    for (i = 0; i < mockDmaQueueCount; i++)
+    {
+        mockSendDma(&mockDmaQueue[i]);
+    }
+
+    mockDmaQueueCount = 0;
+    vtimer++;
+}
+
+void SYS_die(char* err)
+{
+    fprintf(stderr, "SYS_die: %s\n", err);
+    exit(1);
+}
+
+void mockSendDma(const MockDma* dma)
+{
+    if (mockFrame.dmaCount < MOCK_MAX_DMAS_PER_FRAME)
+    {
+        mockFrame.dmas[mockFrame.dmaCount] = *dma;
+    }
+
+    mockFrame.dmaCount++;
+    mockFrame.dmaBytes += dma->len << 1;
+
+    if (mockDmaHandler != NULL)
+    {
+        mockDmaHandler(dma);
+    }
+}
+
+void mockWriteScroll(VDPPlane plane, bool vertical, s16 value)
+{
+    MockScroll scroll;
+    scroll.plane = plane;
+    scroll.vertical = vertical;
+    scroll.value = value;
+
+    if (mockFrame.scrollCount < MOCK_MAX_SCROLLS_PER_FRAME)
+    {
+        mockFrame.scrolls[mockFrame.scrollCount] = scroll;
+    }
+
+    mockFrame.scrollCount++;
+
+    if (mockScrollHandler != NULL)
+    {
+        mockScrollHandler(&scroll);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef MOCKSGDK_H
+#define MOCKSGDK_H
+
+#include <genesis.h>
+
+// SGDK's default DMA queue length.  Transfers queued beyond it are dropped, as on the console.
+#define MOCK_DMA_QUEUE_SIZE 80
+
+// Most DMAs and scroll writes recorded in one frame.  Anything beyond this is still counted, just not kept.
+#define MOCK_MAX_DMAS_PER_FRAME 256
+#define MOCK_MAX_SCROLLS_PER_FRAME 16
+
+// One call to DMA_doDma, or a DMA_queueDma transfer as SYS_doVBlankProcess sends it.
+typedef struct
+{
+    u8 location;
+    const u16* from;
+    u16 to;
+    u16 len;  // In words
+    u16 step;
+    bool immediate;
+} MockDma;
+
+// One call to VDP_setHorizontalScroll or VDP_setVerticalScroll.
+typedef struct
+{
+    VDPPlane plane;
+    bool vertical;
+    s16 value;
+} MockScroll;
+
+// Everything sent to the VDP since the last Mock_beginFrame.
+typedef struct
+{
+    MockDma dmas[MOCK_MAX_DMAS_PER_FRAME];
+    u16 dmaCount;
+    u32 dmaBytes;
+    u16 droppedDmas;  // Queued while the DMA queue was full
+
+    MockScroll scrolls[MOCK_MAX_SCROLLS_PER_FRAME];
+    u16 scrollCount;
+} MockFrame;
+
+extern MockFrame mockFrame;
+
+// What JOY_readJoypad returns.
+extern u16 mockJoypad;
+
+// The cartridge SRAM.  Mock_reset leaves it alone, like the battery would.  Writes while it isn't enabled for writing
+// are ignored.
+#define MOCK_SRAM_SIZE 0x8000
+extern u8 mockSram[MOCK_SRAM_SIZE];
+
+// Called for every DMA as it reaches the VDP: straight away for DMA_doDma, and from SYS_doVBlankProcess for
+// DMA_queueDma.  The source data is only guaranteed to be valid during the call.
+extern void (*mockDmaHandler)(const MockDma* dma);
+
+// Called for every scroll register write.
+extern void (*mockScrollHandler)(const MockScroll* scroll);
+
+// Empty the DMA queue and forget everything recorded so far, e.g. before ScrollingMap_init.
+void Mock_reset();
+
+// Start recording a new frame.
+void Mock_beginFrame();
+
+#endif // MOCKSGDK_H
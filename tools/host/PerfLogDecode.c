@@ -0,0 +1,130 @@
+// Turns the perf log an emulator saved from the cartridge SRAM (see src/PerfLog.h) into CSV, oldest record first.
+//
+//     make -C tools/host perflog
+//     tools/host/perflog [-o log.csv] game.srm
+//
+//     -o  Write the CSV here instead of to stdout.
+//
+// The frame numbers in the log only keep their low 16 bits, so the frame column counts on from the oldest record's.
+
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "PerfLog.h"
+#include "SramFile.h"
+
+// The log's part of the SRAM.
+u8* perfLog = sramFile + PERFLOG_SRAM_START;
+
+u16 readWord(u32 offset);
+u32 readLong(u32 offset);
+
+int main(int argc, char** argv)
+{
+    const char* csvFileName = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'o':
+                csvFileName = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-o log.csv] game.srm\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-o log.csv] game.srm\n", argv[0]);
+        return 2;
+    }
+
+    if (!SramFile_load(argv[optind]))
+    {
+        return 1;
+    }
+
+    if (memcmp(perfLog, PERFLOG_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s: no perf log in this save (PERFLOG_ENABLED may have been 0)\n", argv[optind]);
+        return 1;
+    }
+
+    if (perfLog[PERFLOG_HEADER_VERSION] != PERFLOG_VERSION || perfLog[PERFLOG_HEADER_RECORD_SIZE] != PERFLOG_RECORD_SIZE)
+    {
+        fprintf(stderr, "%s: log version %u with %u byte records; expected version %u with %u byte records\n",
+            argv[optind], perfLog[PERFLOG_HEADER_VERSION], perfLog[PERFLOG_HEADER_RECORD_SIZE], PERFLOG_VERSION,
+            PERFLOG_RECORD_SIZE);
+        return 1;
+    }
+
+    u16 framesPerRecord = readWord(PERFLOG_HEADER_FRAMES_PER_RECORD);
+    u16 capacity = readWord(PERFLOG_HEADER_CAPACITY);
+    u32 recordsWritten = readLong(PERFLOG_HEADER_RECORDS_WRITTEN);
+    if (capacity == 0 || capacity > PERFLOG_CAPACITY)
+    {
+        fprintf(stderr, "%s: bad record capacity %u\n", argv[optind], capacity);
+        return 1;
+    }
+
+    FILE* csv = stdout;
+    if (csvFileName != NULL)
+    {
+        csv = fopen(csvFileName, "w");
+        if (csv == NULL)
+        {
+            perror(csvFileName);
+            return 1;
+        }
+    }
+
+    // Once the ring has wrapped, the oldest record is the one about to be overwritten.
+    u32 recordCount = (recordsWritten < capacity) ? recordsWritten : capacity;
+    u32 slot = (recordsWritten < capacity) ? 0 : recordsWritten % capacity;
+
+    fprintf(csv, "frame,frames,scanlines,dma_bytes,seams,lag_frames\n");
+
+    u32 frame = 0;
+    u16 lastFrame = 0;
+    u32 i;
+    for (i = 0; i < recordCount; i++)
+    {
+        u32 offset = PERFLOG_HEADER_SIZE + (slot * PERFLOG_RECORD_SIZE);
+        u16 recordFrame = readWord(offset + PERFLOG_RECORD_FRAME);
+        frame = (i == 0) ? recordFrame : frame + (u16) (recordFrame - lastFrame);
+        lastFrame = recordFrame;
+
+        fprintf(csv, "%u,%u,%u,%u,%u,%u\n", frame, framesPerRecord, readWord(offset + PERFLOG_RECORD_SCANLINES),
+            readWord(offset + PERFLOG_RECORD_DMA_BYTES), perfLog[offset + PERFLOG_RECORD_SEAMS],
+            perfLog[offset + PERFLOG_RECORD_LAG_FRAMES]);
+
+        slot++;
+        if (slot == capacity)
+        {
+            slot = 0;
+        }
+    }
+
+    if (csv != stdout)
+    {
+        fclose(csv);
+    }
+
+    fprintf(stderr, "%u records (%u written in all)\n", recordCount, recordsWritten);
+    return 0;
+}
+
+u16 readWord(u32 offset)
+{
+    return SramFile_readWord(PERFLOG_SRAM_START + offset);
+}
+
+u32 readLong(u32 offset)
+{
+    return SramFile_readLong(PERFLOG_SRAM_START + offset);
+}
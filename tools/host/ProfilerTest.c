@@ -0,0 +1,196 @@
+// Steps the mock V-counter, VDP status and vtimer through frames the way the console counts them, and checks that
+// zones timed across every part of a frame come out at the right number of scanlines: within the screen, across the
+// start of vblank, and through vblank, where the V-counter jumps back and passes some values twice.  Each run makes
+// _VINT late by a few lines, as when interrupts are masked, so vblank has started before vtimer counts it.
+//
+// A V-counter value vblank passes twice is taken as the first pass unless that would go backwards, so a zone only
+// begins or ends on the second pass if something has been timed since the first, as in a real frame.
+//
+//     make -C tools/host test
+//     tools/host/profilertest [-n zones]
+
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "MathUtil.h"
+#include "MockSGDK.h"
+#include "Profiler.h"
+
+#define DEFAULT_ZONES 20000
+
+// How late _VINT runs, in lines after vblank starts.
+#define MAX_INTERRUPT_DELAY 4
+
+// The backdrop colour outside every zone.
+#define BACKDROP_COLOUR 0x0222
+
+// How the V-counter counts through a frame, from the start of vblank: up from 224 for firstPassLines lines, then from
+// secondPassStart up to 255, then the screen's lines from 0.
+typedef struct
+{
+    const char* name;
+    u16 frameLines;
+    u16 firstPassLines;
+    u16 secondPassStart;
+} VideoSystem;
+
+const VideoSystem ntsc = { "NTSC", 262, 11, 0xE5 };
+const VideoSystem pal = { "PAL", 313, 35, 0xCA };
+
+u32 randomState;
+
+bool runZones(const VideoSystem* system, u16 interruptDelay, u32 zoneCount);
+void setTime(const VideoSystem* system, u16 interruptDelay, u32 time);
+bool isAmbiguous(const VideoSystem* system, u32 time, u32 lastTime);
+u32 nextRandom();
+
+int main(int argc, char** argv)
+{
+    u32 zoneCount = DEFAULT_ZONES;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                zoneCount = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n zones]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    u32 runs = 0;
+    u32 failures = 0;
+
+    u16 interruptDelay;
+    for (interruptDelay = 0; interruptDelay <= MAX_INTERRUPT_DELAY; interruptDelay++)
+    {
+        runs += 2;
+        failures += !runZones(&ntsc, interruptDelay, zoneCount);
+        failures += !runZones(&pal, interruptDelay, zoneCount);
+    }
+
+    printf("%u of %u profiler runs passed\n", runs - failures, runs);
+    return failures != 0;
+}
+
+// Time zoneCount zones of random lengths one after another.  Returns FALSE at the first one that comes out wrong.
+bool runZones(const VideoSystem* system, u16 interruptDelay, u32 zoneCount)
+{
+    IS_PALSYSTEM = (system == &pal);
+    randomState = interruptDelay + 1;
+
+    u32 time = (3 * system->frameLines) + 100;
+    u32 lastTime = time;
+    setTime(system, interruptDelay, time);
+    VDP_setPaletteColor(PROFILER_BACKDROP_INDEX, BACKDROP_COLOUR);
+    Profiler_init();
+
+    u32 i;
+    for (i = 0; i < zoneCount; i++)
+    {
+        // Mostly short zones, but now and then one longer than a frame.
+        u32 lines = (nextRandom() % 8 == 0) ? nextRandom() % (system->frameLines * 2) : nextRandom() % 40;
+        while (isAmbiguous(system, time, lastTime))
+        {
+            time++;
+        }
+
+        while (isAmbiguous(system, time + lines, time))
+        {
+            lines++;
+        }
+
+        setTime(system, interruptDelay, time);
+        Profiler_beginZone(PROFILER_ZONE_SCROLLINGMAP);
+        if (PROFILER_RASTER_BARS != 0 && VDP_getPaletteColor(PROFILER_BACKDROP_INDEX) == BACKDROP_COLOUR)
+        {
+            printf("%s, _VINT %u lines late: zone %u didn't change the backdrop colour\n", system->name, interruptDelay,
+                i);
+            return FALSE;
+        }
+
+        setTime(system, interruptDelay, time + lines);
+        Profiler_endZone(PROFILER_ZONE_SCROLLINGMAP);
+        if (VDP_getPaletteColor(PROFILER_BACKDROP_INDEX) != BACKDROP_COLOUR)
+        {
+            printf("%s, _VINT %u lines late: zone %u didn't put the backdrop colour back\n", system->name,
+                interruptDelay, i);
+            return FALSE;
+        }
+
+        const ProfilerZone* zone = Profiler_getZone(PROFILER_ZONE_SCROLLINGMAP);
+        if (zone->lastLines != lines)
+        {
+            printf("%s, _VINT %u lines late: zone %u from line %u to %u of a frame took %u lines, timed as %u\n",
+                system->name, interruptDelay, i, time % system->frameLines, (time + lines) % system->frameLines, lines,
+                zone->lastLines);
+            return FALSE;
+        }
+
+        lastTime = time + lines;
+        time = lastTime + (nextRandom() % 20);
+    }
+
+    return TRUE;
+}
+
+// Set what the V-counter, the VDP status and vtimer read at a time in scanlines.  Frames start with vblank, which is
+// when vtimer goes up, except that _VINT doesn't get to count it until interruptDelay lines in.
+void setTime(const VideoSystem* system, u16 interruptDelay, u32 time)
+{
+    u16 vblankLines = system->frameLines - SCREEN_PIXEL_HEIGHT;
+    u32 frame = time / system->frameLines;
+    u16 line = time % system->frameLines;
+
+    if (line >= vblankLines)
+    {
+        mockVCounter = line - vblankLines;
+        mockVdpStatus = 0;
+        vtimer = frame;
+        return;
+    }
+
+    if (line < system->firstPassLines)
+    {
+        mockVCounter = (SCREEN_PIXEL_HEIGHT + line) & 0xFF;
+    }
+    else
+    {
+        mockVCounter = system->secondPassStart + line - system->firstPassLines;
+    }
+
+    mockVdpStatus = VDP_VBLANK_FLAG;
+    vtimer = frame;
+    if (line < interruptDelay)
+    {
+        mockVdpStatus |= VDP_VINTPENDING_FLAG;
+        vtimer = frame - 1;
+    }
+}
+
+// Whether the V-counter reads the same at time as it did earlier in the same vblank, with nothing timed in between.
+bool isAmbiguous(const VideoSystem* system, u32 time, u32 lastTime)
+{
+    u16 vblankLines = system->frameLines - SCREEN_PIXEL_HEIGHT;
+    u32 frameStart = time - (time % system->frameLines);
+    u16 line = time % system->frameLines;
+    if (line < system->firstPassLines || line >= vblankLines)
+    {
+        return FALSE;
+    }
+
+    u16 firstPassLine = (system->secondPassStart + line - system->firstPassLines - SCREEN_PIXEL_HEIGHT) & 0xFF;
+    return firstPassLine < system->firstPassLines && lastTime <= frameStart + firstPassLine;
+}
+
+// A small LCG, so every run can be repeated.
+u32 nextRandom()
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 16) & 0x7FFF;
+}
@@ -0,0 +1,101 @@
+// Turns a joypad recording an emulator saved from the cartridge SRAM (see JOYPAD_MODE_RECORD in
+// src/JoypadHandler.h) into C source, so it can be built into the ROM and replayed with Joypad_replay.
+//
+//     make -C tools/host recording2c
+//     tools/host/recording2c [-n name] [-o recording.c] game.srm
+//
+//     -n  Name of the array (default demoRecording).  Its run count is in <name>RunCount.
+//     -o  Write the source here instead of to stdout.
+
+#include <genesis.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "JoypadHandler.h"
+#include "SramFile.h"
+
+int main(int argc, char** argv)
+{
+    const char* name = "demoRecording";
+    const char* sourceFileName = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                name = optarg;
+                break;
+            case 'o':
+                sourceFileName = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n name] [-o recording.c] game.srm\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-n name] [-o recording.c] game.srm\n", argv[0]);
+        return 2;
+    }
+
+    if (!SramFile_load(argv[optind]))
+    {
+        return 1;
+    }
+
+    if (memcmp(sramFile + JOYPAD_SRAM_START, JOYPAD_SRAM_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s: no joypad recording in this save\n", argv[optind]);
+        return 1;
+    }
+
+    u16 runCount = SramFile_readWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_RUN_COUNT);
+    if (runCount == 0 || runCount > JOYPAD_SRAM_MAX_RUNS)
+    {
+        fprintf(stderr, "%s: %s\n", argv[optind], (runCount == 0) ? "the recording is empty" : "bad run count");
+        return 1;
+    }
+
+    FILE* source = stdout;
+    if (sourceFileName != NULL)
+    {
+        source = fopen(sourceFileName, "w");
+        if (source == NULL)
+        {
+            perror(sourceFileName);
+            return 1;
+        }
+    }
+
+    u32 frames = 0;
+    u16 i;
+    for (i = 0; i < runCount; i++)
+    {
+        frames += SramFile_readWord(JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_SIZE + (i * JOYPAD_SRAM_RUN_SIZE));
+    }
+
+    fprintf(source, "/* Autogenerated by recording2c */\n\n");
+    fprintf(source, "#include \"JoypadHandler.h\"\n\n");
+    fprintf(source, "// %u frames: frame count and joypad state of each run.\n", frames);
+    fprintf(source, "const JoypadRun %s[] =\n{\n", name);
+    for (i = 0; i < runCount; i++)
+    {
+        u32 offset = JOYPAD_SRAM_START + JOYPAD_SRAM_HEADER_SIZE + (i * JOYPAD_SRAM_RUN_SIZE);
+        fprintf(source, "    { %u, 0x%04X }%s\n", SramFile_readWord(offset), SramFile_readWord(offset + 2),
+            (i + 1 < runCount) ? "," : "");
+    }
+
+    fprintf(source, "};\n\n");
+    fprintf(source, "const u16 %sRunCount = %u;\n", name, runCount);
+
+    if (source != stdout)
+    {
+        fclose(source);
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include "SramFile.h"
+
+u8 sramFile[SRAMFILE_SIZE];
+
+u8 sramFileData[SRAMFILE_SIZE * 2];
+
+u16 countUsedBytes(u16 first, size_t size);
+
+bool SramFile_load(const char* fileName)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        perror(fileName);
+        return FALSE;
+    }
+
+    size_t size = fread(sramFileData, 1, sizeof(sramFileData), file);
+    fclose(file);
+
+    memset(sramFile, 0, sizeof(sramFile));
+    if (size <= SRAMFILE_SIZE)
+    {
+        memcpy(sramFile, sramFileData, size);
+        return TRUE;
+    }
+
+    // The SRAM is on the odd addresses, but some emulators keep it on the even ones.  The unused half is all 0x00 or
+    // 0xFF.
+    u16 first = (countUsedBytes(1, size) >= countUsedBytes(0, size)) ? 1 : 0;
+    size_t i;
+    for (i = 0; i < SRAMFILE_SIZE && first + (i * 2) < size; i++)
+    {
+        sramFile[i] = sramFileData[first + (i * 2)];
+    }
+
+    return TRUE;
+}
+
+u16 SramFile_readWord(u32 offset)
+{
+    return (sramFile[offset] << 8) | sramFile[offset + 1];
+}
+
+u32 SramFile_readLong(u32 offset)
+{
+    return ((u32) SramFile_readWord(offset) << 16) | SramFile_readWord(offset + 2);
+}
+
+// How many of every other byte from first are something other than 0x00 or 0xFF.
+u16 countUsedBytes(u16 first, size_t size)
+{
+    u16 count = 0;
+    size_t i;
+    for (i = first; i < size; i += 2)
+    {
+        if (sramFileData[i] != 0x00 && sramFileData[i] != 0xFF)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,20 @@
+#ifndef SRAMFILE_H
+#define SRAMFILE_H
+
+#include <genesis.h>
+
+// The cartridge SRAM is 8 bits wide, so it holds 32KB.
+#define SRAMFILE_SIZE 0x8000
+
+// The SRAM as the 68000 sees it through SGDK's SRAM_read* functions.
+extern u8 sramFile[SRAMFILE_SIZE];
+
+// Read an emulator's save file into sramFile.  Emulators save the SRAM either as the 32KB it holds, or as the 64KB of
+// address space it sits in with every other byte unused; both are understood.  Returns FALSE if the file can't be
+// read.
+bool SramFile_load(const char* fileName);
+
+u16 SramFile_readWord(u32 offset);
+u32 SramFile_readLong(u32 offset);
+
+#endif // SRAMFILE_H
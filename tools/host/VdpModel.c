@@ -0,0 +1,102 @@
+#include <genesis.h>
+#include "MockSGDK.h"
+#include "VdpModel.h"
+
+// The engine always uses 64x32 tile planes.
+#define PLANE_PIXEL_WIDTH_MASK 511
+#define PLANE_PIXEL_HEIGHT_MASK 255
+#define PLANE_TILE_WIDTH 64
+
+u16 vdpVram[0x8000];
+s16 vdpVsram[2];
+bool vdpLineScroll;
+
+void applyDma(const MockDma* dma);
+void applyScroll(const MockScroll* scroll);
+
+void VdpModel_init(bool lineScroll)
+{
+    memset(vdpVram, 0, sizeof(vdpVram));
+    vdpVsram[0] = 0;
+    vdpVsram[1] = 0;
+    vdpLineScroll = lineScroll;
+
+    mockDmaHandler = applyDma;
+    mockScrollHandler = applyScroll;
+}
+
+void VdpModel_renderPlane(VDPPlane plane, u8* pixels)
+{
+    u16 planeAddr = (plane == BG_A) ? VDP_BG_A : VDP_BG_B;
+
+    // Plane A's scroll values come first in both the H-scroll table and VSRAM.
+    u16 scrollIndex = (plane == BG_A) ? 0 : 1;
+    u16 planeY = vdpVsram[scrollIndex];
+
+    u16 y;
+    for (y = 0; y < VDPMODEL_SCREEN_HEIGHT; y++)
+    {
+        // Each line's entry is 4 bytes: plane A then plane B.
+        u16 line = vdpLineScroll ? y : 0;
+        s16 hscroll = vdpVram[(VDP_HSCROLL_TABLE >> 1) + (line << 1) + scrollIndex];
+
+        u16 pixelY = (planeY + y) & PLANE_PIXEL_HEIGHT_MASK;
+        const u16* nameRow = vdpVram + (planeAddr >> 1) + ((pixelY >> 3) * PLANE_TILE_WIDTH);
+
+        u16 x;
+        for (x = 0; x < VDPMODEL_SCREEN_WIDTH; x++)
+        {
+            u16 pixelX = (x - hscroll) & PLANE_PIXEL_WIDTH_MASK;
+            u16 name = nameRow[pixelX >> 3];
+
+            u16 tileX = pixelX & 7;
+            u16 tileY = pixelY & 7;
+            if (name & 0x0800)
+            {
+                tileX = 7 - tileX;
+            }
+
+            if (name & 0x1000)
+            {
+                tileY = 7 - tileY;
+            }
+
+            // Tiles are 32 bytes, 4 bits per pixel, leftmost pixel in the high nibble.
+            u16 word = vdpVram[((name & 0x07FF) << 4) + (tileY << 1) + (tileX >> 2)];
+            u16 colour = (word >> ((3 - (tileX & 3)) << 2)) & 15;
+
+            *pixels = VDPMODEL_PIXEL(name >> 15, (name >> 13) & 3, colour);
+            pixels++;
+        }
+    }
+}
+
+void applyDma(const MockDma* dma)
+{
+    if (dma->location != DMA_VRAM)
+    {
+        return;
+    }
+
+    u16 to = dma->to;
+    u16 i;
+    for (i = 0; i < dma->len; i++)
+    {
+        vdpVram[(to >> 1) & 0x7FFF] = dma->from[i];
+        to += dma->step;
+    }
+}
+
+void applyScroll(const MockScroll* scroll)
+{
+    u16 scrollIndex = (scroll->plane == BG_A) ? 0 : 1;
+    if (scroll->vertical)
+    {
+        vdpVsram[scrollIndex] = scroll->value;
+    }
+    else
+    {
+        // SGDK writes the first entry of the H-scroll table, which is all the VDP reads in HSCROLL_PLANE mode.
+        vdpVram[(VDP_HSCROLL_TABLE >> 1) + scrollIndex] = scroll->value;
+    }
+}
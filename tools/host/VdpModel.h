@@ -0,0 +1,25 @@
+#ifndef VDPMODEL_H
+#define VDPMODEL_H
+
+#include <genesis.h>
+
+// A model of the parts of the VDP the engine draws with: VRAM, the scroll tables and two 64x32 tile planes.  It sees
+// everything MockSGDK sends to the VDP and can render what each plane would show on a 320x224 screen.
+
+#define VDPMODEL_SCREEN_WIDTH 320
+#define VDPMODEL_SCREEN_HEIGHT 224
+
+// A rendered pixel: colour index in bits 0-3, palette in bits 4-5 and the tile's priority in bit 6.
+#define VDPMODEL_PIXEL(priority, palette, colour) ((u8) (((priority) << 6) | ((palette) << 4) | (colour)))
+
+extern u16 vdpVram[0x8000];
+extern s16 vdpVsram[2];
+
+// Clear VRAM and start watching MockSGDK.  lineScroll matches the mode passed to VDP_setScrollingMode: per-line
+// H-scroll (HSCROLL_LINE) or one value per plane (HSCROLL_PLANE).
+void VdpModel_init(bool lineScroll);
+
+// Render the screen as plane would show it, on its own, into pixels (VDPMODEL_SCREEN_WIDTH * VDPMODEL_SCREEN_HEIGHT).
+void VdpModel_renderPlane(VDPPlane plane, u8* pixels);
+
+#endif // VDPMODEL_H
@@ -0,0 +1,129 @@
+#ifndef GENESIS_H
+#define GENESIS_H
+
+// Just enough of SGDK's genesis.h to build the engine on a PC.  The functions are implemented in MockSGDK.c, which
+// records what the engine asks the VDP to do instead of doing it.
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef volatile u8 vu8;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+typedef s16 fix16;
+typedef s32 fix32;
+typedef u8 bool;
+
+#define TRUE 1
+#define FALSE 0
+
+#ifndef NULL
+#define NULL ((void*) 0)
+#endif
+
+#define FIX16_INT_BITS 10
+#define FIX16_FRAC_BITS 6
+#define FIX16(value) ((fix16) ((value) * (1 << FIX16_FRAC_BITS)))
+
+#define PAL0 0
+#define PAL1 1
+#define PAL2 2
+#define PAL3 3
+
+#define TILE_ATTR_FULL(pal, prio, flipV, flipH, index) ((((u16) (prio)) << 15) | (((u16) (pal)) << 13) | (((u16) (flipV)) << 12) | (((u16) (flipH)) << 11) | ((u16) (index)))
+
+#define DMA_VRAM 0
+#define DMA_CRAM 1
+#define DMA_VSRAM 2
+
+typedef enum
+{
+    BG_B,
+    BG_A,
+    WINDOW
+} VDPPlane;
+
+typedef enum
+{
+    CPU,
+    DMA,
+    DMA_QUEUE,
+    DMA_QUEUE_COPY
+} TransferMethod;
+
+#define HSCROLL_PLANE 0
+#define HSCROLL_TILE 2
+#define HSCROLL_LINE 3
+#define VSCROLL_PLANE 0
+#define VSCROLL_2TILE 1
+
+#define JOY_1 0
+
+#define BUTTON_UP 0x0001
+#define BUTTON_DOWN 0x0002
+#define BUTTON_LEFT 0x0004
+#define BUTTON_RIGHT 0x0008
+#define BUTTON_B 0x0010
+#define BUTTON_C 0x0020
+#define BUTTON_A 0x0040
+#define BUTTON_START 0x0080
+
+// SGDK's default VRAM layout.
+extern u16 VDP_BG_A;
+extern u16 VDP_BG_B;
+extern u16 VDP_HSCROLL_TABLE;
+extern u16 VDP_WINDOW;
+
+// The first tile of the font VDP_init loads.  The value only matters to the host build.
+#define TILE_FONT_INDEX 1440
+
+extern vu32 vtimer;
+
+// The V-counter and VDP status register read whatever MockSGDK was last told.
+#define VDP_VINTPENDING_FLAG (1 << 7)
+#define VDP_VBLANK_FLAG (1 << 3)
+extern u16 mockVCounter;
+extern u16 mockVdpStatus;
+#define GET_VCOUNTER mockVCounter
+#define GET_VDP_STATUS(flag) (mockVdpStatus & (flag))
+
+// A variable here rather than a read of the VDP status, so a run can pretend to be on a PAL console.
+extern u8 IS_PALSYSTEM;
+
+bool DMA_queueDma(u8 location, void* from, u16 to, u16 len, u16 step);
+void DMA_doDma(u8 location, void* from, u16 to, u16 len, s16 step);
+
+void VDP_setPlanSize(u16 w, u16 h);
+void VDP_loadTileData(const u32* data, u16 index, u16 num, TransferMethod tm);
+void VDP_setHorizontalScroll(VDPPlane plane, s16 value);
+void VDP_setVerticalScroll(VDPPlane plane, s16 value);
+void VDP_setBGAAddress(u16 value);
+void VDP_setBGBAddress(u16 value);
+void VDP_setPaletteColor(u16 index, u16 value);
+u16 VDP_getPaletteColor(u16 index);
+void VDP_setWindowHPos(bool right, u16 pos);
+void VDP_setWindowVPos(bool down, u16 pos);
+
+u16 JOY_readJoypad(u16 joy);
+
+// The cartridge SRAM, in MockSGDK's mockSram.  Offsets are in bytes of SRAM, as with SGDK.
+void SRAM_enable();
+void SRAM_enableRO();
+void SRAM_disable();
+u8 SRAM_readByte(u32 offset);
+u16 SRAM_readWord(u32 offset);
+u32 SRAM_readLong(u32 offset);
+void SRAM_writeByte(u32 offset, u8 value);
+void SRAM_writeWord(u32 offset, u16 value);
+void SRAM_writeLong(u32 offset, u32 value);
+
+void SYS_doVBlankProcess();
+void SYS_die(char* err);
+
+#endif // GENESIS_H